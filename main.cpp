@@ -1,13 +1,40 @@
 #include "src/View/main_window.h"
 
 #include "src/Model/eqn_solver.h"
+#include "src/Model/engine_benchmark.h"
+#include "src/Model/genetic_algorithm.h"
 
 #include <QApplication>
+#include <QCoreApplication>
+
+#include <cstring>
+#include <iostream>
+#include <memory>
 
 int main(int argc, char *argv[])
 {
     //testsolver();
 
+    // Headless engine comparison: BicycleModelV2 --benchmark [results.csv]
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        QCoreApplication app(argc, argv);
+        return benchmarkMain(argc > 2 ? QString::fromLocal8Bit(argv[2]) : QString("EngineBenchmark.csv"));
+    }
+
+    // Headless resume of a checkpointed GA run: BicycleModelV2 --resume <file.ckpt>
+    if (argc > 2 && std::strcmp(argv[1], "--resume") == 0) {
+        QCoreApplication app(argc, argv);
+        QString error;
+        std::unique_ptr<GeneticAlgorithm> ga(GeneticAlgorithm::resume(QString::fromLocal8Bit(argv[2]), &error));
+        if (!ga) {
+            std::cerr << error.toStdString() << std::endl;
+            return 1;
+        }
+        QObject::connect(ga.get(), &OptimizerEngine::summaryReady, [](const QString& summary) { std::cout << summary.toStdString() << std::endl; });
+        ga->run();
+        return ga->noSolution ? 1 : 0;
+    }
+
     QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
     QApplication::setAttribute(Qt::AA_UseHighDpiPixmaps);
     QGuiApplication::setHighDpiScaleFactorRoundingPolicy(
@@ -1,4 +1,5 @@
 #include "src/Controller/input_manager.h"
+#include "src/Model/result_store.h"
 #include <QThread>
 #include <QObject>
 
@@ -93,39 +94,82 @@ bool InputManager::validateAndStoreInt(QLineEdit* edit, int& target){
 
 
 
-GeneticAlgorithm* InputManager::startOptimization(OptimizationConfig& opt, SolverConfig& sol, Vehicle& veh, QProgressBar* progressBar, QLabel* statusLabel){
+OptimizerEngine* InputManager::startOptimization(OptimizationConfig& opt, SolverConfig& sol, Vehicle& veh, QProgressBar* progressBar, QLabel* statusLabel,
+                                                 const QString& checkpointFile, std::shared_ptr<RunMemory> runMemory,
+                                                 std::shared_ptr<ResultStore> resultStore){
     if (!inputsVerification(veh, sol, opt)){
         return nullptr;
     }
 
-    GeneticAlgorithm* ga = new GeneticAlgorithm(veh, opt, sol);
-    
+    OptimizerEngine* engine = OptimizerEngine::create(veh, opt, sol);
+    if (GeneticAlgorithm* ga = qobject_cast<GeneticAlgorithm*>(engine)) {
+        ga->setCheckpointFile(checkpointFile);
+        ga->setRunMemory(runMemory);
+    }
+
+    // A configuration already optimized is answered from the store, the engine never gets a thread
+    engine->setResultStore(resultStore);
+    StoredResult stored;
+    if (engine->lookupStoredResult(stored)) {
+        QObject::connect(engine, &OptimizerEngine::finished, statusLabel, [=]() {
+            statusLabel->setText("Optimization finished! (stored result)");
+        });
+        // Queued, so the caller connects its slots before the signals are emitted
+        QMetaObject::invokeMethod(engine, [engine, stored]() {
+            engine->replay(stored);
+            engine->deleteLater();
+        }, Qt::QueuedConnection);
+        return engine;
+    }
+
+    launch(engine, progressBar, statusLabel);
+    return engine;
+}
+
+OptimizerEngine* InputManager::resumeOptimization(const QString& checkpointFile, QProgressBar* progressBar, QLabel* statusLabel){
+    QString error;
+    GeneticAlgorithm* engine = GeneticAlgorithm::resume(checkpointFile, &error);
+    if (!engine) {
+        QMessageBox::warning(nullptr, "Resume Error", error);
+        return nullptr;
+    }
+    launch(engine, progressBar, statusLabel);
+    return engine;
+}
+
+void InputManager::launch(OptimizerEngine* engine, QProgressBar* progressBar, QLabel* statusLabel){
     // Create thread
     QThread* thread = new QThread();
 
-    // Move GA to this thread
-    ga->moveToThread(thread);
+    // Move the engine to this thread
+    engine->moveToThread(thread);
 
-    // When thread starts, run GA
-    QObject::connect(thread, &QThread::started, ga, &GeneticAlgorithm::run);
+    // When thread starts, run the engine
+    QObject::connect(thread, &QThread::started, engine, &OptimizerEngine::run);
 
     // Progress -> progress bar
-    QObject::connect(ga, &GeneticAlgorithm::progressChanged, progressBar, &QProgressBar::setValue);
+    QObject::connect(engine, &OptimizerEngine::progressChanged, progressBar, &QProgressBar::setValue);
+
+    // Telemetry -> status label, arrives at the same limited rate as the progress
+    QObject::connect(engine, &OptimizerEngine::progressUpdated, statusLabel, [=](const ProgressInfo& info) {
+        QString eta = info.etaSeconds >= 0.0 ? QString("%1 s").arg(info.etaSeconds, 0, 'f', 0) : QString("--");
+        statusLabel->setText(QString("Optimization running... %1 solves/s, %2 % converged, best %3 m/s, ETA %4")
+                                 .arg(info.solvesPerSecond, 0, 'f', 1).arg(100.0 * info.convergedRatio, 0, 'f', 0)
+                                 .arg(info.bestFitness, 0, 'f', 3).arg(eta));
+    });
 
     // Finished -> status label
-    QObject::connect(ga, &GeneticAlgorithm::finished, [=]() {
+    QObject::connect(engine, &OptimizerEngine::finished, [=]() {
         statusLabel->setText("Optimization finished!");
         thread->quit();   // stop the thread
     });
 
     // Cleanup when thread finishes
-    QObject::connect(thread, &QThread::finished, ga, &QObject::deleteLater);
+    QObject::connect(thread, &QThread::finished, engine, &QObject::deleteLater);
     QObject::connect(thread, &QThread::finished, thread, &QObject::deleteLater);
 
     // Start thread
     thread->start();
-
-    return ga;
 }
 
 void InputManager:: showTooltip(QLineEdit* edit, const QString& message){
@@ -13,6 +13,9 @@
 
 // Forward declaration is needed because GeneticAlgorithm.h includes this file, creating a circular dependency.
 class GeneticAlgorithm;
+class OptimizerEngine;
+class RunMemory;
+class ResultStore;
 
 //! Converts an angle from degrees to radians.
 double degreeToRad(double deg);
@@ -25,7 +28,7 @@ double radToDegree(double rad);
  * @brief A static utility class for managing GUI input and launching the optimization process.
  *
  * This class provides methods to validate user input from QLineEdit widgets,
- * provide visual feedback, and set up and run the GeneticAlgorithm in a separate
+ * provide visual feedback, and set up and run the selected OptimizerEngine in a separate
  * thread to keep the GUI responsive.
  */
 class InputManager {
@@ -64,19 +67,37 @@ public:
     static bool validateAndStoreInt(QLineEdit* edit, int& target);
 
     /**
-     * @brief Starts the genetic algorithm optimization in a separate thread.
-     * This function verifies all inputs, creates the GA, moves it to a new thread,
+     * @brief Starts the optimization in a separate thread.
+     * This function verifies all inputs, creates the engine selected at OptimizationConfig::engine, moves it to a new thread,
      * connects GUI signals (progress bar, status label), and starts the process.
      * @param opt The optimization configuration.
      * @param sol The solver configuration.
      * @param veh The vehicle configuration.
      * @param progressBar Pointer to the GUI progress bar to update.
      * @param statusLabel Pointer to the GUI status label to update.
-     * @return A pointer to the created GeneticAlgorithm instance, or nullptr if inputs are invalid.
+     * @param checkpointFile File where the genetic algorithm saves its checkpoints (empty disables them).
+     * @param runMemory Result of the previous run, seeds the genetic algorithm and receives its result (null disables the warm start).
+     * @param resultStore Finished runs, a configuration already stored is answered without starting a thread (null disables it).
+     * @return A pointer to the created OptimizerEngine instance, or nullptr if inputs are invalid.
      */
-    static GeneticAlgorithm* startOptimization(OptimizationConfig& opt, SolverConfig& sol, Vehicle& veh, QProgressBar* progressBar, QLabel* statusLabel);
+    static OptimizerEngine* startOptimization(OptimizationConfig& opt, SolverConfig& sol, Vehicle& veh, QProgressBar* progressBar, QLabel* statusLabel,
+                                              const QString& checkpointFile = QString(), std::shared_ptr<RunMemory> runMemory = nullptr,
+                                              std::shared_ptr<ResultStore> resultStore = nullptr);
+
+    /**
+     * @brief Continues a genetic algorithm run saved in a checkpoint file, in a separate thread.
+     * The vehicle and configurations are the ones saved in the file, not the ones of the GUI.
+     * @param checkpointFile The checkpoint file, the resumed run keeps saving to it.
+     * @param progressBar Pointer to the GUI progress bar to update.
+     * @param statusLabel Pointer to the GUI status label to update.
+     * @return A pointer to the created OptimizerEngine instance, or nullptr if the file can not be read.
+     */
+    static OptimizerEngine* resumeOptimization(const QString& checkpointFile, QProgressBar* progressBar, QLabel* statusLabel);
     
 private:
+    //! Moves an engine to a new thread, connects it to the progress bar and status label and starts it.
+    static void launch(OptimizerEngine* engine, QProgressBar* progressBar, QLabel* statusLabel);
+
     //! A helper function to display a validation error message as a tooltip next to a QLineEdit.
     static void showTooltip(QLineEdit* edit, const QString& message);
 
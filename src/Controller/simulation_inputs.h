@@ -2,6 +2,7 @@
 #define SIMULATIONINPUTS_H
 
 #include <cmath>
+#include <memory>
 #include <QMap>
 #include "src/Model/tire_model.h"
 #include "ceres/ceres.h"
@@ -44,6 +45,20 @@ struct Vehicle {
     Vehicle(double r, double a_val, double b_val, double mi, double gamma, double cd, double af, double f_r);
 };
 
+/**
+ * @struct SolveStats
+ * @brief Compact statistics of the last solve of an Individual.
+ * It replaces the full ceres::Solver::Summary (strings, a vector of iterations and timings),
+ * so Individuals stay a few hundred bytes and are cheap to copy, sort and send through signals.
+ */
+
+struct SolveStats {
+    int iterations = 0;                                     // Number of solver iterations
+    double finalCost = 0.0;                                 // Final value of the cost function
+    ceres::TerminationType termination = ceres::FAILURE;    // Reason why the solver stopped
+    double solveTime = 0.0;                                 // Total time spent in the solver [s]
+};
+
 // Struct for an individual
 
 struct Individual {
@@ -62,7 +77,7 @@ struct Individual {
     double Fres_f;              // Rolling resistance force on the front axle
     double F_D;                 // Aerodynamic drag force
 
-    ceres::Solver::Summary summary; // Store the summary of the solver
+    SolveStats stats;               // Statistics of the last solve, the full summary is only kept on demand
 
     std::array<double, 7> residuals; // Store the residuals after solving
 
@@ -72,6 +87,16 @@ struct Individual {
     void defineGuesses(double alphaF, double alphaR, double kappaF, double kappaR, double V, double Vx, double Vy);
 };
 
+/**
+ * @enum SolverFormulation
+ * @brief Selects the system of equations solved for each Individual.
+ */
+
+enum class SolverFormulation {
+    Full,           // 7 unknowns (alpha_f, alpha_r, kappa_f, kappa_r, V, Vx, Vy) and 7 residuals
+    Reduced         // 4 unknowns (kappa_f, kappa_r, Vx, Vy), slip angles and V substituted from the kinematics
+};
+
 /**
  * @struct SolverConfig
  * @brief Holds configuration parameters for the numerical solver.
@@ -79,7 +104,54 @@ struct Individual {
 
 struct SolverConfig {
     int maxIter = 100;        // Max quantity of iterations allowed for each solver call (standard value = 100)
-    vector<double> Tolerances = vector<double>(7, 1e-6); // Vector of size 7, initialized to 10E6
+    vector<double> Tolerances = vector<double>(7, 1e-6); // Vector of size 7, initialized to 10E6, applied to the legacy-weighted residuals
+    SolverFormulation formulation = SolverFormulation::Full;   // System of equations solved for each Individual
+    bool adaptiveScaling = true;    // Derive residual weights and variable normalization from the Vehicle instead of the fixed 1600 kg scales
+};
+
+/**
+ * @enum OptimizerType
+ * @brief Selects which OptimizerEngine is launched by the InputManager.
+ */
+
+enum class OptimizerType {
+    Genetic,        // Genetic algorithm over delta and the solver initial guesses
+    Brent,          // Bracketed scalar search over delta only, with warm-started solves
+    CMAES,          // Covariance matrix adaptation evolution strategy over delta and the slip guesses
+    DifferentialEvolution   // DE/rand/1/bin over delta and the slip guesses
+};
+
+/**
+ * @enum InitSampling
+ * @brief Design used to spread the initial population over delta and the solver guesses.
+ */
+
+enum class InitSampling {
+    Random,         // Independent uniform draws
+    LatinHypercube, // One sample per stratum of every gene, in each batch
+    Sobol           // Low-discrepancy Sobol sequence with a random digital shift
+};
+
+/**
+ * @enum MigrationTopology
+ * @brief Selects which islands receive the migrants of the island-model GA.
+ */
+
+enum class MigrationTopology {
+    Ring,           // Island i sends to island i+1
+    FullyConnected, // Every island sends to all the others
+    Random          // Each migration goes to one island drawn at random
+};
+
+/**
+ * @enum NichingMethod
+ * @brief Selects how the generational GA keeps several delta niches in its population.
+ */
+
+enum class NichingMethod {
+    None,           // Plain fitness, the population may collapse onto a single delta
+    Clearing,       // Only the best NicheCapacity Individuals of each delta niche keep their fitness for selection
+    Sharing         // Fitness divided by the niche count, Individuals crowded on one delta are penalized
 };
 
 /**
@@ -88,6 +160,7 @@ struct SolverConfig {
  */
 
 struct OptimizationConfig {
+    OptimizerType engine = OptimizerType::Genetic;
     int GenNum = 1;
     int PopSize = 1;
     double minDelta = -0.3, maxDelta = 0.3;
@@ -96,7 +169,80 @@ struct OptimizationConfig {
     double minV = 0.0, maxV = 100.0;
     double minVx = 0.0, maxVx = 100.0;
     double minVy = -50.0, maxVy = 50.0;
+    int MultiStarts = 1;            // Initial guesses solved in parallel for each new Individual (1 disables multi-start)
+    int Threads = 0;                // Worker threads used to solve the population (0 shares the application scheduler, one worker per core)
+    double ProgressRate = 20.0;     // Max progress updates per second sent to the GUI (0 sends every percentage change)
+    double TimeBudget = 0.0;        // Wall-clock seconds after which the run stops and returns the best result so far (0 disables)
+
+    // Genetic engine variants
+    bool SteadyState = false;       // Asynchronous steady-state GA without generations, children replace tournament losers as soon as they are solved (Islands is ignored)
+
+    unsigned long long Seed = 0;    // Seed of every random decision of the stochastic engines, the same seed gives the same run (0 draws a new one, reported in the summary)
+
+    // Initial population (Genetic engine)
+    InitSampling Sampling = InitSampling::Sobol;
+    int InitBudget = 0;             // Max solver calls spent on the initial population (0 uses 20 x PopSize)
+    int FastFailSamples = 64;       // The initialization gives up if none of the first samples converges
 
+    // Early termination (Genetic engine)
+    int StagnationWindow = 10;      // Generations without a significant best fitness improvement before stopping (0 disables)
+    double MinImprovement = 1e-4;   // Relative best fitness improvement that counts as significant
+    double MinFitnessStd = 0.0;     // Stop when the population fitness standard deviation [m/s] falls below this value (0 disables)
+    double MinDeltaSpread = 0.0;    // Stop when the population delta spread (max - min) [rad] falls below this value (0 disables)
+
+    // Fitness memoization (Genetic engine)
+    double CacheQuantum = 1e-9;     // Genomes (delta and guesses) equal after rounding to this step reuse the stored solver result (0 disables the cache)
+    bool RejectDuplicates = false;  // Drop mutated clones and children whose genome was already solved, so new ones are bred instead
+
+    // Surrogate pre-screening (generational and island GA)
+    bool Surrogate = false;         // Breed more children than needed and only solve the ones a model fitted on the solved Individuals ranks best
+    int SurrogateOversample = 4;    // Candidate children bred per child solved when the surrogate is on
+    int SurrogatePoints = 256;      // Latest solved Individuals used to fit the model (its cost grows with the cube of this value)
+
+    // Niching and diversity maintenance (generational and island GA)
+    NichingMethod Niching = NichingMethod::None;
+    double NicheRadius = 0.01;      // Delta distance [rad] inside which two Individuals share a niche (one delta mutation step)
+    int NicheCapacity = 1;          // Individuals of a niche that keep their fitness under clearing
+    int EntropyBins = 32;           // Bins of the delta histogram whose entropy measures the diversity of the population
+    double MinDeltaEntropy = 0.0;   // Normalized delta entropy (0 all in one bin, 1 even spread) below which fresh samples replace the worst Individuals (0 disables)
+    double InjectionShare = 0.2;    // Share of the population replaced by fresh samples at each injection
+
+    // Self-adaptive operators (generational and island GA)
+    bool AdaptiveOperators = false; // Scale the mutation steps and the crossover spread with the 1/5th success rule, the steps also follow the bounds
+    double AdaptationFactor = 1.22; // Scale multiplier applied after each generation (grow above 1/5 successful offspring, shrink below)
+    double MinOperatorScale = 0.05; // Lower limit of the scales
+    double MaxOperatorScale = 20.0; // Upper limit of the scales
+
+    // Memetic refinement (Genetic engine, the steady-state GA only refines its final population)
+    bool Memetic = false;           // Refine the elites with a Brent search on delta, warm-started from their own solution
+    int MemeticInterval = 5;        // Generations between two refinements, the final population is always refined
+    int MemeticElites = 2;          // Best Individuals refined each time
+    int MemeticMaxIter = 12;        // Max solver calls of one local search
+    double MemeticRadius = 0.01;    // Half width [rad] of the delta interval searched around an elite (one delta mutation step)
+
+    // Warm start from the previous run (Genetic engine)
+    bool ColdStart = false;         // Ignore the previous run and build the whole initial population from the sampling design
+    double WarmStartShare = 0.5;    // Max share of the initial population taken from the best Individuals of the previous run, re-solved first
+
+    // Checkpoints (generational GA with a single population)
+    int CheckpointInterval = 10;    // Generations between two checkpoints written in the background (0 disables, nothing is written without a checkpoint file)
+
+    // Island model settings (Genetic engine)
+    int Islands = 1;                // Sub-populations evolved independently, PopSize is split among them (1 keeps a single population)
+    int MigrationInterval = 5;      // Generations between two migrations of an island
+    int MigrationCount = 2;         // Best Individuals sent at each migration
+    MigrationTopology Topology = MigrationTopology::Ring;
+
+    // Brent engine settings
+    int ScanPoints = 21;            // Number of uniformly spaced delta samples used to bracket the maximum
+    int BrentMaxIter = 50;          // Max quantity of Brent iterations inside the bracket
+    double BrentTol = 1e-5;         // Absolute tolerance on delta [rad]
+
+    // CMA-ES and differential evolution settings (GenNum, PopSize, Seed and the early termination criteria also apply)
+    double CmaSigma = 0.3;          // Initial CMA-ES step size, relative to the gene ranges
+    double CmaTolX = 1e-6;          // CMA-ES stops when the step size along every axis falls below this value (relative to the ranges)
+    double DEWeight = 0.5;          // Differential weight F of the mutation x_r1 + F (x_r2 - x_r3)
+    double DECrossover = 0.9;       // Probability CR of taking each gene from the mutant
 };
 
 /**
@@ -168,6 +314,9 @@ void setDefaultTires(PacejkaParams &frontTire, PacejkaParams &rearTire);
  * @brief A container class that holds all simulation data, configurations, and results.
  * This acts as a central hub for passing simulation state between different parts of the application.
  */
+class RunMemory;
+class ResultStore;
+
 class SimulationContext {
 public:
     Vehicle veh;                            //!< The vehicle's physical characteristics.
@@ -177,6 +326,8 @@ public:
     QMap<QString, PacejkaParams> m_tires;   //!< A map to store different named tire models.
     int runCount = 1;                       //!< A counter for the number of simulation runs.
     QString resultsText;                    //!< A string to store formatted results for display.
+    std::shared_ptr<RunMemory> runMemory;   //!< Final population and solver cache of the last run, seeds the next one.
+    std::shared_ptr<ResultStore> resultStore;   //!< Finished runs on the disk, a configuration already optimized is not run again.
 };
 
 
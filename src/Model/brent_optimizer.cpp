@@ -0,0 +1,244 @@
+#include "src/Model/brent_optimizer.h"
+#include "src/Model/task_scheduler.h"
+
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+
+double brentMaximize(const function<double(double)>& f, double a, double b, double tol, int maxIter, double& xBest) {
+    const double golden = 0.3819660112501051;   // (3 - sqrt(5)) / 2
+    const double eps = 1e-12;
+
+    if (a > b) swap(a, b);
+
+    // The method minimizes, so the function is negated
+    double x = a + golden * (b - a);
+    double w = x, v = x;
+    double fx = -f(x);
+    double fw = fx, fv = fx;
+    double d = 0.0, e = 0.0;
+
+    for (int iter = 1; iter < maxIter; iter++) {
+        double m = 0.5 * (a + b);
+        double tol1 = tol + eps * abs(x);
+        double tol2 = 2.0 * tol1;
+
+        // Stop when the bracket is small enough around x
+        if (abs(x - m) <= tol2 - 0.5 * (b - a)) break;
+
+        bool goldenStep = true;
+        if (abs(e) > tol1) {
+            // Try a parabolic step through x, w and v
+            double r = (x - w) * (fx - fv);
+            double q = (x - v) * (fx - fw);
+            double p = (x - v) * q - (x - w) * r;
+            q = 2.0 * (q - r);
+            if (q > 0.0) p = -p; else q = -q;
+            double eOld = e;
+            e = d;
+            if (abs(p) < abs(0.5 * q * eOld) && p > q * (a - x) && p < q * (b - x)) {
+                d = p / q;
+                double u = x + d;
+                if (u - a < tol2 || b - u < tol2) d = (x < m) ? tol1 : -tol1;
+                goldenStep = false;
+            }
+        }
+        if (goldenStep) {
+            e = (x < m) ? b - x : a - x;
+            d = golden * e;
+        }
+
+        double u = (abs(d) >= tol1) ? x + d : x + ((d > 0.0) ? tol1 : -tol1);
+        double fu = -f(u);
+
+        // Update the bracket and the three best points
+        if (fu <= fx) {
+            if (u < x) b = x; else a = x;
+            v = w; fv = fw;
+            w = x; fw = fx;
+            x = u; fx = fu;
+        } else {
+            if (u < x) a = u; else b = u;
+            if (fu <= fw || w == x) {
+                v = w; fv = fw;
+                w = u; fw = fu;
+            } else if (fu <= fv || v == x || v == w) {
+                v = u; fv = fu;
+            }
+        }
+    }
+
+    xBest = x;
+    return -fx;
+}
+
+BrentOptimizer::BrentOptimizer(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN)
+        : OptimizerEngine(vehicle, optIN, solIN), evaluations(0), failedEvaluations(0) {
+        // Cold guesses, the same ones used to map the tangent speed, kept inside the solver bounds
+        Individual low, high;
+        low.defineGuesses(0.0, 0.0, 0.0, 0.0, 10.0, 10.0, 0.0);
+        high.defineGuesses(clamp(0.03, opt.minAlphaf, opt.maxAlphaf), clamp(0.03, opt.minAlphar, opt.maxAlphar),
+                           clamp(0.01, opt.minKappaf, opt.maxKappaf), clamp(0.01, opt.minKappar, opt.maxKappar), 25.0, 25.0, 1.0);
+        coldStarts.push_back(low);
+        coldStarts.push_back(high);
+    }
+
+void BrentOptimizer::updateProgress() {
+        // Every call to solveAt() is a unit of work, the scan chunks report from several threads
+        progress.advance();
+        publishProgress();
+    }
+
+Individual BrentOptimizer::solveAt(double delta, WarmStart& warm) {
+    auto abort = [this]() { return stopRequested(); };
+    if (stopRequested()) {
+        // Stopped run: the remaining points are not solved
+        Individual skipped;
+        skipped.delta = delta;
+        return skipped;
+    }
+
+    // First try: start from the last converged solution
+    if (warm.valid) {
+        Individual ind = warm.ind;
+        ind.delta = delta;
+        ind.fitness = 0.0;
+        ind.converged = false;
+        solveIndividual(ind, veh, sol, opt, abort);
+        if (ind.converged && ind.fitness > 0) {
+            warm.ind = ind;
+            evaluations++;
+            progress.recordSolve(true);
+            progress.recordBest(ind.fitness);
+            updateProgress();
+            return ind;
+        }
+    }
+
+    // Fallback: cold guesses
+    for (const Individual& guess : coldStarts) {
+        Individual ind = guess;
+        ind.delta = delta;
+        solveIndividual(ind, veh, sol, opt, abort);
+        if (ind.converged && ind.fitness > 0) {
+            warm.ind = ind;
+            warm.valid = true;
+            evaluations++;
+            progress.recordSolve(true);
+            progress.recordBest(ind.fitness);
+            updateProgress();
+            return ind;
+        }
+    }
+
+    // Non-converged points are penalized with zero velocity
+    failedEvaluations++;
+    progress.recordSolve(false);
+    updateProgress();
+    Individual failed;
+    failed.delta = delta;
+    return failed;
+}
+
+QString BrentOptimizer::engineName() const {
+    return "Brent (delta only)";
+}
+
+bool BrentOptimizer::reproducible() const {
+    // Nothing is random, only a TimeBudget can change the result
+    return opt.TimeBudget <= 0.0;
+}
+
+QString BrentOptimizer::engineReport() const {
+    QString report;
+    report += QString("Scan Points: %1\n").arg(opt.ScanPoints);
+    report += QString("Brent Tolerance: %1 rad\n").arg(opt.BrentTol);
+    report += QString("Solver Calls: %1 (%2 not converged)\n").arg(evaluations + failedEvaluations).arg(failedEvaluations.load());
+    return report;
+}
+
+void BrentOptimizer::run() {
+    // --- 1. INITIALIZATION ---
+    int scanPoints = max(opt.ScanPoints, 3);
+    progress.start(100.0 / (scanPoints + opt.BrentMaxIter));
+    evaluations = 0;
+    failedEvaluations = 0;
+    cancellation->start(opt.TimeBudget);
+    scheduler->resetStats();
+
+    Individual best;
+
+    // --- 2. BRACKETING SCAN ---
+    // Sweep delta with warm starts, so the solver follows the same equilibrium branch.
+    // The sweep is split in contiguous chunks of 3 points, each one warm-started along its own chain.
+    // The chunks only depend on ScanPoints, so the warm starts and the result are the same on any number of cores.
+    vector<double> deltas(scanPoints);
+    vector<Individual> samples(scanPoints);
+    for (int i = 0; i < scanPoints; i++) {
+        deltas[i] = opt.minDelta + (opt.maxDelta - opt.minDelta) * i / (scanPoints - 1);
+    }
+
+    int chunks = max(1, scanPoints / 3);
+    TaskGroup group(*scheduler);
+    for (int c = 0; c < chunks; c++) {
+        int first = c * scanPoints / chunks;
+        int last = (c + 1) * scanPoints / chunks;
+        group.run([this, &deltas, &samples, first, last]() {
+            WarmStart warm;
+            for (int i = first; i < last; i++) {
+                samples[i] = solveAt(deltas[i], warm);
+            }
+        });
+    }
+    group.wait();
+
+    // Lowest index wins ties, so the bracket does not depend on thread timing
+    int bestIdx = -1;
+    for (int i = 0; i < scanPoints; i++) {
+        if (samples[i].fitness > best.fitness) {
+            best = samples[i];
+            bestIdx = i;
+        }
+    }
+
+    // If no delta converged, exit early and update progress
+    if (bestIdx < 0) {
+        noSolution = true;
+        emit summaryReady(generateSummary(Individual()));
+        emit progressChanged(100);
+        emit finished();
+        return;
+    }
+
+    // --- 3. BRENT REFINEMENT ---
+    // The maximum lies between the neighbours of the best sample
+    double lower = deltas[max(bestIdx - 1, 0)];
+    double upper = deltas[min(bestIdx + 1, scanPoints - 1)];
+    WarmStart warm;
+    warm.ind = best;
+    warm.valid = true;
+
+    auto velocityAt = [&](double delta) {
+        // Once stopped, solveAt() returns at once, so the remaining iterations are cheap and best is kept
+        Individual ind = solveAt(delta, warm);
+        if (ind.fitness > best.fitness) {
+            best = ind;
+        }
+        return ind.fitness;
+    };
+    double deltaBest;
+    brentMaximize(velocityAt, lower, upper, opt.BrentTol, opt.BrentMaxIter, deltaBest);
+
+    bestIndividual = best;
+
+    // Generate the summary report.
+    QString summary = generateSummary(bestIndividual);
+
+    // Emit signals to notify the GUI that the process is complete.
+    emit optimizationFinished(bestIndividual);
+    emit progressChanged(100);
+    emit summaryReady(summary + storeResult());
+    emit finished();
+}
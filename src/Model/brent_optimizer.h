@@ -0,0 +1,86 @@
+#ifndef BRENTOPTIMIZER_H
+#define BRENTOPTIMIZER_H
+#pragma once
+
+#include "src/model/eqn_solver.h"
+#include "src/model/optimizer_engine.h"
+#include "src/controller/simulation_inputs.h"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Maximizes a scalar function inside [a, b] with Brent's method.
+ * Golden-section steps are combined with parabolic interpolation, so a smooth maximum is
+ * found in a few tens of evaluations. The function may return a penalty for points where
+ * it can not be evaluated, in this case the method falls back to golden-section steps.
+ * @param f The function to be maximized.
+ * @param a Lower end of the bracket.
+ * @param b Upper end of the bracket.
+ * @param tol Absolute tolerance on x.
+ * @param maxIter Maximum number of function evaluations.
+ * @param xBest Receives the abscissa of the best point found.
+ * @return The best function value found.
+ */
+double brentMaximize(const std::function<double(double)>& f, double a, double b, double tol, int maxIter, double& xBest);
+
+/**
+ * @class BrentOptimizer
+ * @brief Finds the steering angle (delta) that gives the highest cornering velocity with a scalar search.
+ *
+ * Delta is the only true design variable of an Individual, the other genes are just initial
+ * guesses for the equation solver. This engine first scans [minDelta, maxDelta] with
+ * OptimizationConfig::ScanPoints samples to bracket the maximum, and then refines the bracket
+ * with brentMaximize(). The scan is split in contiguous chunks of 3 points, whatever the number
+ * of workers, that run in parallel on the TaskScheduler, every solve is warm-started from the last
+ * converged solution of its chunk. Points
+ * where the solver does not converge are treated as a zero velocity penalty.
+ */
+
+class BrentOptimizer : public OptimizerEngine {
+    Q_OBJECT
+private:
+
+    /**
+     * @struct WarmStart
+     * @brief Last converged solution of a chain of solves, used as initial guess for the next one.
+     */
+    struct WarmStart {
+        Individual ind;
+        bool valid = false;             //!< True once a converged solution is available
+    };
+
+    void updateProgress();              //!< Call to update the progress bar at the GUI, safe from any thread
+    Individual solveAt(double delta, WarmStart& warm);  //!< Solves the vehicle at delta, warm-started from the last converged solution of the chain.
+
+protected:
+    QString engineName() const override;
+    QString engineReport() const override;
+    bool reproducible() const override;
+
+private:
+
+    // Private member variables
+    std::vector<Individual> coldStarts; //!< Initial guesses tried when there is no warm start or it fails
+
+    std::atomic<int> evaluations;       //!< Number of calls to solveAt() that converged
+    std::atomic<int> failedEvaluations; //!< Number of calls to solveAt() that did not converge
+
+public:
+    /**
+     * @brief Constructor for the BrentOptimizer class.
+     * @param vehicle The Vehicle object with fixed parameters.
+     * @param optIN The OptimizationConfig with the delta range and the Brent settings.
+     * @param solIN The SolverConfig for the equation solver.
+     */
+
+    BrentOptimizer(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN);
+
+    /**
+     * @brief The main entry point to start the scalar optimization.
+     */
+    void run() override;
+};
+
+#endif
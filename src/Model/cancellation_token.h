@@ -0,0 +1,45 @@
+#ifndef CANCELLATIONTOKEN_H
+#define CANCELLATIONTOKEN_H
+#pragma once
+
+#include <QElapsedTimer>
+
+#include <atomic>
+
+/**
+ * @class CancellationToken
+ * @brief Stop request shared between the GUI and a running optimizer, plus its wall-clock budget.
+ *
+ * The optimizer polls cancelled() between solves and inside the solver iterations, and returns the
+ * best result found so far once it is true. cancel() is safe from any thread, the token is held by
+ * a shared pointer so the GUI can keep it after the engine is deleted.
+ */
+
+class CancellationToken {
+public:
+    /**
+     * @brief Starts the clock of a run.
+     * @param budgetSeconds Wall-clock time allowed, 0 or negative for no limit.
+     */
+    void start(double budgetSeconds) {
+        budgetNs = budgetSeconds > 0.0 ? static_cast<long long>(budgetSeconds * 1e9) : 0;
+        clock.start();
+    }
+
+    //! Asks the run to stop as soon as possible.
+    void cancel() { requested.store(true, std::memory_order_relaxed); }
+
+    //! True once the run was cancelled or its budget expired.
+    bool cancelled() const { return userRequested() || budgetExpired(); }
+
+    bool userRequested() const { return requested.load(std::memory_order_relaxed); }
+    bool budgetExpired() const { return budgetNs > 0 && clock.nsecsElapsed() >= budgetNs; }
+    double budget() const { return budgetNs * 1e-9; }
+
+private:
+    std::atomic<bool> requested{false};
+    long long budgetNs = 0;             //!< 0 when the run has no time limit
+    QElapsedTimer clock;
+};
+
+#endif
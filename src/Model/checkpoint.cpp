@@ -0,0 +1,217 @@
+#include "src/Model/checkpoint.h"
+
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSaveFile>
+
+#include <chrono>
+#include <type_traits>
+
+using namespace std;
+
+namespace {
+    const quint32 Magic = 0x424d434b;      // "BMCK"
+    const quint32 Version = 4;
+
+    // Plain structs are stored as raw bytes, the header rejects files of a build with another layout
+    static_assert(is_trivially_copyable<Individual>::value, "Individual is stored as raw bytes");
+    static_assert(is_trivially_copyable<OptimizationConfig>::value, "OptimizationConfig is stored as raw bytes");
+    static_assert(is_trivially_copyable<StagnationMonitor>::value, "StagnationMonitor is stored as raw bytes");
+    static_assert(is_trivially_copyable<OperatorAdaptation>::value, "OperatorAdaptation is stored as raw bytes");
+    static_assert(is_trivially_copyable<AdaptationStep>::value, "AdaptationStep is stored as raw bytes");
+    static_assert(is_trivially_copyable<FitnessCache::Entry>::value, "FitnessCache::Entry is stored as raw bytes");
+    static_assert(is_trivially_copyable<SurrogateModel::Point>::value, "SurrogateModel::Point is stored as raw bytes");
+
+    template <typename T>
+    void writeRaw(QDataStream& out, const T* data, size_t count) {
+        out.writeRawData(reinterpret_cast<const char*>(data), static_cast<int>(sizeof(T) * count));
+    }
+
+    template <typename T>
+    bool readRaw(QDataStream& in, T* data, size_t count) {
+        int bytes = static_cast<int>(sizeof(T) * count);
+        return in.readRawData(reinterpret_cast<char*>(data), bytes) == bytes;
+    }
+
+    // Every coefficient of PacejkaParams is a double declared after the name
+    pair<char*, int> tireCoefficients(PacejkaParams& tire) {
+        char* first = reinterpret_cast<char*>(&tire.p_Cx1);
+        return {first, static_cast<int>(reinterpret_cast<char*>(&tire + 1) - first)};
+    }
+
+    void writeTire(QDataStream& out, const PacejkaParams& tire) {
+        auto block = tireCoefficients(const_cast<PacejkaParams&>(tire));
+        out << tire.name;
+        out.writeRawData(block.first, block.second);
+    }
+
+    bool readTire(QDataStream& in, PacejkaParams& tire) {
+        auto block = tireCoefficients(tire);
+        in >> tire.name;
+        return in.readRawData(block.first, block.second) == block.second;
+    }
+}
+
+bool writeCheckpoint(const QString& path, const GaCheckpoint& state) {
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) return false;
+
+    QDataStream out(&file);
+    out << Magic << Version << quint32(sizeof(Individual)) << quint32(sizeof(OptimizationConfig)) << quint32(sizeof(PacejkaParams));
+
+    // Problem definition, so a headless resume needs nothing but the file
+    const Vehicle& veh = state.veh;
+    out << veh.R << veh.a << veh.b << veh.m << veh.gamma_w << veh.Cd << veh.Af << veh.f_r_F;
+    writeTire(out, veh.FrontTire);
+    writeTire(out, veh.RearTire);
+    out << qint32(state.sol.maxIter) << quint32(state.sol.Tolerances.size());
+    writeRaw(out, state.sol.Tolerances.data(), state.sol.Tolerances.size());
+    out << qint32(static_cast<int>(state.sol.formulation)) << state.sol.adaptiveScaling;
+    writeRaw(out, &state.opt, 1);
+
+    // Run state
+    out << quint64(state.seed) << qint32(state.generation) << state.elapsedSeconds
+        << quint64(state.solveCount) << quint64(state.initSamples) << quint64(state.initFeasible);
+    writeRaw(out, &state.stagnation, 1);
+    writeRaw(out, &state.adaptation, 1);
+    writeRaw(out, &state.bestFound, 1);
+    out << quint32(state.bestTrace.size());
+    writeRaw(out, state.bestTrace.data(), state.bestTrace.size());
+    out << quint32(state.adaptationTrace.size());
+    writeRaw(out, state.adaptationTrace.data(), state.adaptationTrace.size());
+
+    const Population& pop = state.population;
+    out << quint32(pop.size());
+    for (int g = 0; g < static_cast<int>(Gene::Count); g++) {
+        writeRaw(out, pop.gene(static_cast<Gene>(g)), pop.size());
+    }
+    writeRaw(out, pop.fitness(), pop.size());
+    writeRaw(out, pop.converged(), pop.size());
+
+    out << quint32(state.cache.size());
+    writeRaw(out, state.cache.data(), state.cache.size());
+
+    out << quint32(state.surrogatePoints.size()) << quint64(state.surrogateNext)
+        << quint64(state.surrogatePredictions) << quint64(state.surrogateScreened);
+    writeRaw(out, state.surrogatePoints.data(), state.surrogatePoints.size());
+    writeRaw(out, state.surrogateFitness.data(), state.surrogateFitness.size());
+    writeRaw(out, state.surrogateConverged.data(), state.surrogateConverged.size());
+
+    if (out.status() != QDataStream::Ok) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+bool readCheckpoint(const QString& path, GaCheckpoint& state, QString* error) {
+    auto fail = [error](const QString& reason) {
+        if (error) *error = reason;
+        return false;
+    };
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return fail(QString("Cannot open %1").arg(path));
+
+    QDataStream in(&file);
+    quint32 magic, version, individualSize, optSize, tireSize;
+    in >> magic >> version >> individualSize >> optSize >> tireSize;
+    if (magic != Magic) return fail("Not a checkpoint file");
+    if (version != Version || individualSize != sizeof(Individual) || optSize != sizeof(OptimizationConfig) || tireSize != sizeof(PacejkaParams)) {
+        return fail("The checkpoint was written by another version of the program");
+    }
+
+    Vehicle& veh = state.veh;
+    in >> veh.R >> veh.a >> veh.b >> veh.m >> veh.gamma_w >> veh.Cd >> veh.Af >> veh.f_r_F;
+    if (!readTire(in, veh.FrontTire) || !readTire(in, veh.RearTire)) return fail("Truncated checkpoint");
+    qint32 maxIter, formulation;
+    quint32 count;
+    in >> maxIter >> count;
+    state.sol.maxIter = maxIter;
+    state.sol.Tolerances.resize(count);
+    if (!readRaw(in, state.sol.Tolerances.data(), count)) return fail("Truncated checkpoint");
+    in >> formulation >> state.sol.adaptiveScaling;
+    state.sol.formulation = static_cast<SolverFormulation>(formulation);
+    if (!readRaw(in, &state.opt, 1)) return fail("Truncated checkpoint");
+
+    quint64 seed, solveCount, initSamples, initFeasible;
+    qint32 generation;
+    in >> seed >> generation >> state.elapsedSeconds >> solveCount >> initSamples >> initFeasible;
+    state.seed = seed;
+    state.generation = generation;
+    state.solveCount = solveCount;
+    state.initSamples = initSamples;
+    state.initFeasible = initFeasible;
+    if (!readRaw(in, &state.stagnation, 1) || !readRaw(in, &state.adaptation, 1) || !readRaw(in, &state.bestFound, 1)) return fail("Truncated checkpoint");
+    in >> count;
+    state.bestTrace.resize(count);
+    if (!readRaw(in, state.bestTrace.data(), count)) return fail("Truncated checkpoint");
+    in >> count;
+    state.adaptationTrace.resize(count);
+    if (!readRaw(in, state.adaptationTrace.data(), count)) return fail("Truncated checkpoint");
+
+    Population& pop = state.population;
+    in >> count;
+    pop.resize(count);
+    for (int g = 0; g < static_cast<int>(Gene::Count); g++) {
+        if (!readRaw(in, pop.gene(static_cast<Gene>(g)), count)) return fail("Truncated checkpoint");
+    }
+    if (!readRaw(in, pop.fitness(), count) || !readRaw(in, pop.converged(), count)) return fail("Truncated checkpoint");
+
+    in >> count;
+    state.cache.resize(count);
+    if (!readRaw(in, state.cache.data(), count)) return fail("Truncated checkpoint");
+
+    quint64 surrogateNext, surrogatePredictions, surrogateScreened;
+    in >> count >> surrogateNext >> surrogatePredictions >> surrogateScreened;
+    state.surrogateNext = surrogateNext;
+    state.surrogatePredictions = surrogatePredictions;
+    state.surrogateScreened = surrogateScreened;
+    state.surrogatePoints.resize(count);
+    state.surrogateFitness.resize(count);
+    state.surrogateConverged.resize(count);
+    if (!readRaw(in, state.surrogatePoints.data(), count) || !readRaw(in, state.surrogateFitness.data(), count)
+        || !readRaw(in, state.surrogateConverged.data(), count)) return fail("Truncated checkpoint");
+
+    if (in.status() != QDataStream::Ok) return fail("Truncated checkpoint");
+    return true;
+}
+
+CheckpointWriter::~CheckpointWriter() {
+    wait();
+}
+
+bool CheckpointWriter::busy() const {
+    return pending.valid() && pending.wait_for(chrono::seconds(0)) != future_status::ready;
+}
+
+void CheckpointWriter::submit(const QString& path, unique_ptr<GaCheckpoint> state) {
+    wait();     // Two writes of the same file never overlap
+
+    // The state is owned by the task, the optimizer keeps running on its own copy
+    shared_ptr<GaCheckpoint> owned(std::move(state));
+    pending = async(launch::async, [this, path, owned]() {
+        QElapsedTimer timer;
+        timer.start();
+        if (writeCheckpoint(path, *owned)) {
+            writtenCount++;
+        } else {
+            failedCount++;
+        }
+        writeNanos += timer.nsecsElapsed();
+    });
+}
+
+void CheckpointWriter::wait() {
+    if (pending.valid()) {
+        pending.get();
+    }
+}
+
+void CheckpointWriter::resetStats() {
+    writtenCount = 0;
+    droppedCount = 0;
+    failedCount = 0;
+    writeNanos = 0;
+}
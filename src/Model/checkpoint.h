@@ -0,0 +1,111 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+#include "src/Model/population.h"
+#include "src/Model/fitness_cache.h"
+#include "src/Model/stagnation_monitor.h"
+#include "src/Model/operator_adaptation.h"
+#include "src/Model/surrogate_model.h"
+
+#include <QString>
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct GaCheckpoint
+ * @brief Full state of a generational GA run after a complete generation.
+ *
+ * The random streams are a pure function of the seed and the generation, so the seed and the
+ * generation counter are the whole generator state. With the population, the stopping criteria,
+ * the fitness cache and the points of the surrogate (its fit is a pure function of them), a resumed
+ * run breeds exactly the same generations as an uninterrupted one.
+ */
+
+struct GaCheckpoint {
+    Vehicle veh;
+    OptimizationConfig opt;
+    SolverConfig sol;
+
+    uint64_t seed = 0;                  // Seed of the counter-based random streams
+    int generation = 0;                 // Generations completed (0 right after the initial population)
+    double elapsedSeconds = 0.0;        // Wall-clock time of the run so far
+    uint64_t solveCount = 0;            // Solver calls so far
+    uint64_t initSamples = 0;           // Candidates solved by the initialization
+    uint64_t initFeasible = 0;          // Converged candidates of the initialization
+
+    Population population;
+    StagnationMonitor stagnation{OptimizationConfig()};
+    OperatorAdaptation adaptation{OptimizationConfig()};
+    std::vector<AdaptationStep> adaptationTrace;
+    Individual bestFound;
+    std::vector<std::pair<double, double>> bestTrace;
+    std::vector<FitnessCache::Entry> cache;
+
+    std::vector<SurrogateModel::Point> surrogatePoints;     // Training points of the surrogate, in storage order
+    std::vector<double> surrogateFitness;
+    std::vector<unsigned char> surrogateConverged;
+    uint64_t surrogateNext = 0;         // Ring position of the next surrogate point
+    uint64_t surrogatePredictions = 0;  // Candidates ranked by the surrogate so far
+    uint64_t surrogateScreened = 0;     // Candidates discarded by the surrogate so far
+};
+
+/**
+ * @brief Writes a checkpoint to a compact binary file.
+ * The file is replaced atomically, a crash while writing keeps the previous checkpoint.
+ * @return false if the file could not be written.
+ */
+bool writeCheckpoint(const QString& path, const GaCheckpoint& state);
+
+/**
+ * @brief Reads a checkpoint written by writeCheckpoint().
+ * @param path The checkpoint file.
+ * @param state Receives the saved run.
+ * @param error Receives the reason of a failure, may be null.
+ * @return false if the file can not be read or was written by an incompatible build.
+ */
+bool readCheckpoint(const QString& path, GaCheckpoint& state, QString* error = nullptr);
+
+/**
+ * @class CheckpointWriter
+ * @brief Writes checkpoints on a background thread, off the generational loop.
+ *
+ * Only one write is in flight: the optimizer checks busy() before copying its state and drops
+ * the checkpoint if the previous one is still being written, so a slow disk never makes the
+ * generational loop wait or queue up copies.
+ */
+
+class CheckpointWriter {
+public:
+    CheckpointWriter() = default;
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    bool busy() const;              //!< True while a write is in flight.
+    void submit(const QString& path, std::unique_ptr<GaCheckpoint> state);   //!< Starts an asynchronous write, after the previous one has finished.
+    void drop() { droppedCount++; } //!< Counts a checkpoint skipped because the writer was busy.
+    void wait();                    //!< Blocks until the pending write is done.
+    void resetStats();
+
+    size_t written() const { return writtenCount.load(); }
+    size_t dropped() const { return droppedCount.load(); }
+    size_t failed() const { return failedCount.load(); }
+    double writeSeconds() const { return writeNanos.load() * 1e-9; }   //!< Background time spent writing
+
+private:
+    std::future<void> pending;
+    std::atomic<size_t> writtenCount{0};
+    std::atomic<size_t> droppedCount{0};
+    std::atomic<size_t> failedCount{0};
+    std::atomic<long long> writeNanos{0};
+};
+
+#endif
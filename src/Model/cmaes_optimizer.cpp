@@ -0,0 +1,198 @@
+#include "src/Model/cmaes_optimizer.h"
+#include "src/Model/task_scheduler.h"
+#include "src/Model/sampling.h"
+#include "src/Model/philox.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace std;
+
+namespace {
+    // Random stream ids of the engine
+    const uint32_t SamplingShift = 0;
+    const uint32_t Sample = 1;
+
+    // Velocity guesses used until a point converges (the warm guesses of the Brent engine)
+    Individual coldVelocity() {
+        Individual ind;
+        ind.defineGuesses(0.0, 0.0, 0.0, 0.0, 25.0, 25.0, 1.0);
+        return ind;
+    }
+}
+
+CmaesOptimizer::CmaesOptimizer(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN)
+        : OptimizerEngine(vehicle, optIN, solIN), stagnation(optIN) {
+        lambda = optIN.PopSize >= 4 ? optIN.PopSize : 4 + static_cast<int>(3.0 * log(static_cast<double>(Dimensions)));
+        mu = lambda / 2;
+    }
+
+Eigen::VectorXd CmaesOptimizer::initialMean(Individual& best) {
+    CounterRng shiftRng(seed, 0, 0, 0, SamplingShift);
+    SobolSequence sobol(Dimensions, shiftRng);
+    vector<array<double, Dimensions>> points(lambda);
+    vector<Individual> batch(lambda);
+    Individual velocity = coldVelocity();
+    for (int k = 0; k < lambda; k++) {
+        sobol.next(points[k].data());
+        batch[k] = decodeGenome(points[k].data(), velocity);
+    }
+    solveBatch(batch);
+
+    // Lowest index wins ties, without a converged point the search starts from the center
+    Eigen::VectorXd mean = Eigen::VectorXd::Constant(Dimensions, 0.5);
+    vector<double> fitness(lambda), delta(lambda);
+    for (int k = 0; k < lambda; k++) {
+        fitness[k] = batch[k].fitness;
+        delta[k] = batch[k].delta;
+        if (batch[k].fitness > best.fitness) {
+            best = batch[k];
+            mean = Eigen::Map<const Eigen::VectorXd>(points[k].data(), Dimensions);
+        }
+    }
+    stagnation.update(0, fitness.data(), delta.data(), lambda);
+    return mean;
+}
+
+QString CmaesOptimizer::engineName() const {
+    return "CMA-ES";
+}
+
+QString CmaesOptimizer::engineReport() const {
+    QString report;
+    report += QString("Generations: %1\n").arg(opt.GenNum);
+    report += QString("Samples per Generation: %1 (%2 parents)\n").arg(lambda).arg(mu);
+    report += QString("Multi-start Guesses: %1\n").arg(opt.MultiStarts);
+    report += QString("Random Seed: %1\n").arg(static_cast<qulonglong>(seed));
+    report += QString("Solver Calls: %1\n").arg(runStatistics().solverCalls);
+    report += QString("Final Step Size: %1 (axis ratio %2)\n").arg(sigma).arg(axisRatio, 0, 'f', 1);
+    if (stepConverged) {
+        report += QString("Generations Run: %1 of %2\n").arg(stagnation.generation()).arg(opt.GenNum);
+        report += QString("Stopping Reason: step size below %1\n").arg(opt.CmaTolX);
+    } else {
+        report += stoppingReport(stagnation);
+    }
+    return report;
+}
+
+void CmaesOptimizer::run() {
+    // --- 1. INITIALIZATION ---
+    const int n = Dimensions;
+    progress.start(100.0 / ((opt.GenNum + 1) * lambda));
+    cancellation->start(opt.TimeBudget);
+    scheduler->resetStats();
+    stagnation = StagnationMonitor(opt);
+    stepConverged = false;
+    seed = drawSeed();
+
+    // Strategy parameters (Hansen, "The CMA Evolution Strategy: A Tutorial")
+    vector<double> weights(mu);
+    for (int i = 0; i < mu; i++) {
+        weights[i] = log(mu + 0.5) - log(i + 1.0);
+    }
+    double weightSum = accumulate(weights.begin(), weights.end(), 0.0);
+    double weightSq = 0.0;
+    for (double& w : weights) {
+        w /= weightSum;
+        weightSq += w * w;
+    }
+    double mueff = 1.0 / weightSq;
+    double cc = (4.0 + mueff / n) / (n + 4.0 + 2.0 * mueff / n);
+    double cs = (mueff + 2.0) / (n + mueff + 5.0);
+    double c1 = 2.0 / ((n + 1.3) * (n + 1.3) + mueff);
+    double cmu = min(1.0 - c1, 2.0 * (mueff - 2.0 + 1.0 / mueff) / ((n + 2.0) * (n + 2.0) + mueff));
+    double damps = 1.0 + 2.0 * max(0.0, sqrt((mueff - 1.0) / (n + 1.0)) - 1.0) + cs;
+    double chiN = sqrt(static_cast<double>(n)) * (1.0 - 1.0 / (4.0 * n) + 1.0 / (21.0 * n * n));
+
+    // --- 2. STARTING POINT ---
+    Individual best;
+    Eigen::VectorXd mean = initialMean(best);
+    sigma = opt.CmaSigma;
+    Eigen::VectorXd pc = Eigen::VectorXd::Zero(n), ps = Eigen::VectorXd::Zero(n);
+    Eigen::MatrixXd C = Eigen::MatrixXd::Identity(n, n);
+    Eigen::MatrixXd B = Eigen::MatrixXd::Identity(n, n);
+    Eigen::VectorXd D = Eigen::VectorXd::Ones(n);
+
+    // --- 3. GENERATIONAL LOOP ---
+    vector<Eigen::VectorXd> steps(lambda);
+    vector<Individual> batch(lambda);
+    vector<int> order(lambda);
+    vector<double> fitness(lambda), delta(lambda);
+    for (int gen = 1; gen <= opt.GenNum && !stopRequested(); gen++) {
+        // Sample lambda points, projected onto the bounds; the projected step is the one learned
+        Individual velocity = best.fitness > 0 ? best : coldVelocity();
+        for (int k = 0; k < lambda; k++) {
+            CounterRng rng(seed, 0, static_cast<uint32_t>(gen), static_cast<uint32_t>(k), Sample);
+            Eigen::VectorXd z(n);
+            for (int d = 0; d < n; d++) z(d) = rng.normal();
+            Eigen::VectorXd x = (mean + sigma * (B * D.cwiseProduct(z))).cwiseMax(0.0).cwiseMin(1.0);
+            steps[k] = (x - mean) / sigma;
+            batch[k] = decodeGenome(x.data(), velocity);
+        }
+        solveBatch(batch);
+        if (stopRequested()) break;
+
+        // Rank by fitness, the lowest index wins ties
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&batch](int a, int b) { return batch[a].fitness > batch[b].fitness; });
+        if (batch[order[0]].fitness > best.fitness) {
+            best = batch[order[0]];
+        }
+
+        // Mean and evolution paths
+        Eigen::VectorXd yw = Eigen::VectorXd::Zero(n);
+        for (int i = 0; i < mu; i++) {
+            yw += weights[i] * steps[order[i]];
+        }
+        mean += sigma * yw;
+        Eigen::VectorXd whitened = B * (B.transpose() * yw).cwiseQuotient(D);
+        ps = (1.0 - cs) * ps + sqrt(cs * (2.0 - cs) * mueff) * whitened;
+        double psNorm = ps.norm() / sqrt(1.0 - pow(1.0 - cs, 2.0 * gen));
+        bool hsig = psNorm / chiN < 1.4 + 2.0 / (n + 1.0);
+        pc = (1.0 - cc) * pc + (hsig ? sqrt(cc * (2.0 - cc) * mueff) : 0.0) * yw;
+
+        // Rank-one and rank-mu covariance update, then the step size
+        Eigen::MatrixXd rankMu = Eigen::MatrixXd::Zero(n, n);
+        for (int i = 0; i < mu; i++) {
+            rankMu += weights[i] * steps[order[i]] * steps[order[i]].transpose();
+        }
+        C = (1.0 - c1 - cmu) * C + c1 * (pc * pc.transpose() + (hsig ? 0.0 : cc * (2.0 - cc)) * C) + cmu * rankMu;
+        sigma *= exp((cs / damps) * (ps.norm() / chiN - 1.0));
+
+        // Eigen decomposition for the next samples, cheap with five genes
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigen(0.5 * (C + C.transpose()));
+        B = eigen.eigenvectors();
+        D = eigen.eigenvalues().cwiseMax(1e-20).cwiseSqrt();
+        axisRatio = D.maxCoeff() / D.minCoeff();
+
+        for (int k = 0; k < lambda; k++) {
+            fitness[k] = batch[k].fitness;
+            delta[k] = batch[k].delta;
+        }
+        if (stagnation.update(gen, fitness.data(), delta.data(), lambda)) {
+            break;
+        }
+        if (sigma * D.maxCoeff() < opt.CmaTolX) {
+            stepConverged = true;
+            break;
+        }
+        progress.setStep(100.0 / ((stagnation.estimatedEnd(opt.GenNum) + 1) * lambda));
+    }
+
+    // --- 4. RESULTS ---
+    noSolution = best.fitness <= 0;
+    if (noSolution) {
+        emit summaryReady(generateSummary(Individual()));
+        emit progressChanged(100);
+        emit finished();
+        return;
+    }
+
+    bestIndividual = best;
+    QString summary = generateSummary(bestIndividual);
+    emit optimizationFinished(bestIndividual);
+    emit progressChanged(100);
+    emit summaryReady(summary + storeResult());
+    emit finished();
+}
@@ -0,0 +1,62 @@
+#ifndef CMAESOPTIMIZER_H
+#define CMAESOPTIMIZER_H
+#pragma once
+
+#include "src/model/eqn_solver.h"
+#include "src/model/optimizer_engine.h"
+#include "src/controller/simulation_inputs.h"
+#include "src/Model/stagnation_monitor.h"
+
+#include <Eigen/Dense>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class CmaesOptimizer
+ * @brief Covariance matrix adaptation evolution strategy over delta and the four slip guesses.
+ *
+ * The genome is scaled to the unit hypercube. Every generation samples lambda points from a
+ * multivariate normal distribution, solves them in parallel with solveBatch() and moves the
+ * mean, step size and covariance towards the best mu of them (Hansen's standard (mu/mu_w, lambda)
+ * update with cumulative step-size adaptation). Samples outside the bounds are projected onto
+ * them, non-converged points have zero fitness. The start is the best point of a Sobol design.
+ * With only five genes the covariance learns the correlation between delta and the guesses in a
+ * few generations, so far fewer solves are needed than with the genetic algorithm.
+ */
+
+class CmaesOptimizer : public OptimizerEngine {
+    Q_OBJECT
+public:
+    static constexpr int Dimensions = 5;    //!< delta, alpha_f, alpha_r, kappa_f, kappa_r
+
+    /**
+     * @brief Constructor for the CmaesOptimizer class.
+     * @param vehicle The Vehicle object with fixed parameters.
+     * @param optIN The OptimizationConfig, PopSize is lambda (below 4 the default 4 + 3 ln n is used).
+     * @param solIN The SolverConfig for the equation solver.
+     */
+    CmaesOptimizer(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN);
+
+    /**
+     * @brief The main entry point to start the optimization.
+     */
+    void run() override;
+
+protected:
+    QString engineName() const override;
+    QString engineReport() const override;
+
+private:
+    Eigen::VectorXd initialMean(Individual& best);     //!< Solves a Sobol design and returns the scaled genome of its best point.
+
+    int lambda;                         //!< Samples per generation
+    int mu;                             //!< Parents of the recombination
+    uint64_t seed = 0;                  //!< Seed of the run, the samples are keyed by (seed, generation, sample)
+    double sigma = 0.0;                 //!< Step size at the end of the run
+    double axisRatio = 1.0;             //!< Ratio between the longest and shortest axis of the final distribution
+    bool stepConverged = false;         //!< True if the run ended because sigma fell below CmaTolX
+    StagnationMonitor stagnation;       //!< Early termination criteria shared with the genetic algorithm
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "src/Model/config_hash.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace {
+    // FNV-1a over the bytes of the values, enough to tell configurations apart
+    class KeyBuilder {
+    public:
+        void add(const void* data, size_t bytes) {
+            const unsigned char* p = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < bytes; i++) {
+                hash = (hash ^ p[i]) * 0x100000001b3ULL;
+            }
+        }
+        void add(double value) {
+            if (value == 0.0) value = 0.0;      // -0.0 and 0.0 are the same configuration
+            add(&value, sizeof(value));
+        }
+        void add(int value) { add(&value, sizeof(value)); }
+        void add(bool value) { add(value ? 1 : 0); }
+        void add(unsigned long long value) { add(&value, sizeof(value)); }
+
+        uint64_t hash = 0xcbf29ce484222325ULL;
+    };
+
+    // Every coefficient of PacejkaParams is a double declared after the name
+    void addTire(KeyBuilder& key, const PacejkaParams& tire) {
+        const char* first = reinterpret_cast<const char*>(&tire.p_Cx1);
+        const char* last = reinterpret_cast<const char*>(&tire + 1);
+        for (const char* p = first; p < last; p += sizeof(double)) {
+            double value;
+            memcpy(&value, p, sizeof(value));
+            key.add(value);
+        }
+    }
+}
+
+uint64_t solverProblemKey(const Vehicle& veh, const SolverConfig& sol, const OptimizationConfig& opt) {
+    KeyBuilder key;
+    for (double v : {veh.R, veh.a, veh.b, veh.m, veh.gamma_w, veh.Cd, veh.Af, veh.f_r_F}) key.add(v);
+    addTire(key, veh.FrontTire);
+    addTire(key, veh.RearTire);
+
+    key.add(sol.maxIter);
+    for (double tol : sol.Tolerances) key.add(tol);
+    key.add(static_cast<int>(sol.formulation));
+    key.add(sol.adaptiveScaling);
+
+    // Bounds of the solver variables, the multi-start guesses and the cache rounding
+    for (double v : {opt.minAlphaf, opt.maxAlphaf, opt.minAlphar, opt.maxAlphar, opt.minKappaf, opt.maxKappaf,
+                     opt.minKappar, opt.maxKappar, opt.minV, opt.maxV, opt.minVx, opt.maxVx, opt.minVy, opt.maxVy,
+                     opt.CacheQuantum}) {
+        key.add(v);
+    }
+    key.add(opt.MultiStarts);
+    return key.hash;
+}
+
+uint64_t configurationKey(const Vehicle& veh, const SolverConfig& sol, const OptimizationConfig& opt) {
+    KeyBuilder key;
+    uint64_t problem = solverProblemKey(veh, sol, opt);
+    key.add(&problem, sizeof(problem));
+
+    key.add(static_cast<int>(opt.engine));
+    key.add(opt.GenNum);
+    key.add(opt.PopSize);
+    key.add(opt.minDelta);
+    key.add(opt.maxDelta);
+    key.add(opt.Seed);
+    key.add(opt.SteadyState);
+
+    key.add(static_cast<int>(opt.Sampling));
+    key.add(opt.InitBudget);
+    key.add(opt.FastFailSamples);
+
+    key.add(opt.StagnationWindow);
+    for (double v : {opt.MinImprovement, opt.MinFitnessStd, opt.MinDeltaSpread}) key.add(v);
+    key.add(opt.RejectDuplicates);
+
+    key.add(opt.Surrogate);
+    key.add(opt.SurrogateOversample);
+    key.add(opt.SurrogatePoints);
+
+    key.add(static_cast<int>(opt.Niching));
+    key.add(opt.NicheRadius);
+    key.add(opt.NicheCapacity);
+    key.add(opt.EntropyBins);
+    key.add(opt.MinDeltaEntropy);
+    key.add(opt.InjectionShare);
+
+    key.add(opt.AdaptiveOperators);
+    for (double v : {opt.AdaptationFactor, opt.MinOperatorScale, opt.MaxOperatorScale}) key.add(v);
+
+    key.add(opt.Memetic);
+    key.add(opt.MemeticInterval);
+    key.add(opt.MemeticElites);
+    key.add(opt.MemeticMaxIter);
+    key.add(opt.MemeticRadius);
+
+    key.add(opt.Islands);
+    key.add(opt.MigrationInterval);
+    key.add(opt.MigrationCount);
+    key.add(static_cast<int>(opt.Topology));
+
+    key.add(opt.ScanPoints);
+    key.add(opt.BrentMaxIter);
+    key.add(opt.BrentTol);
+
+    for (double v : {opt.CmaSigma, opt.CmaTolX, opt.DEWeight, opt.DECrossover}) key.add(v);
+    return key.hash;
+}
@@ -0,0 +1,27 @@
+#ifndef CONFIGHASH_H
+#define CONFIGHASH_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <cstdint>
+
+/**
+ * @brief Hash of everything that changes the result of a single solve.
+ * Vehicle and tires, SolverConfig, the solver bounds of OptimizationConfig and the number of
+ * multi-start guesses. Two configurations with the same key give the same solver result for
+ * the same genome, so their fitness cache entries are interchangeable.
+ */
+uint64_t solverProblemKey(const Vehicle& veh, const SolverConfig& sol, const OptimizationConfig& opt);
+
+/**
+ * @brief Hash of everything that changes the result of a whole run.
+ * The solverProblemKey() plus the engine, the seed and every setting of the search. Settings that
+ * only change how fast the same run goes (Threads, ProgressRate, CheckpointInterval) are left out,
+ * so are the tire names: tires with the same coefficients are the same problem. TimeBudget and the
+ * warm start settings are also left out, a run cut by the clock or seeded by the previous run is
+ * not reproducible from the configuration alone and is never looked up by this key.
+ */
+uint64_t configurationKey(const Vehicle& veh, const SolverConfig& sol, const OptimizationConfig& opt);
+
+#endif
@@ -0,0 +1,148 @@
+#include "src/Model/de_optimizer.h"
+#include "src/Model/task_scheduler.h"
+#include "src/Model/sampling.h"
+#include "src/Model/philox.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace {
+    // Random stream ids of the engine
+    const uint32_t SamplingShift = 0;
+    const uint32_t Trial = 1;
+
+    // Velocity guesses used until a point converges (the warm guesses of the Brent engine)
+    Individual coldVelocity() {
+        Individual ind;
+        ind.defineGuesses(0.0, 0.0, 0.0, 0.0, 25.0, 25.0, 1.0);
+        return ind;
+    }
+}
+
+DifferentialEvolution::DifferentialEvolution(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN)
+        : OptimizerEngine(vehicle, optIN, solIN), members(max(optIN.PopSize, 4)), stagnation(optIN) {}
+
+DifferentialEvolution::Genome DifferentialEvolution::trialGenome(const vector<Genome>& population, int target, int generation) const {
+    CounterRng rng(seed, 0, static_cast<uint32_t>(generation), static_cast<uint32_t>(target), Trial);
+
+    // Three distinct members, all different from the target
+    uint32_t n = static_cast<uint32_t>(members);
+    int r[3];
+    for (int i = 0; i < 3; i++) {
+        do {
+            r[i] = static_cast<int>(rng.index(n));
+        } while (r[i] == target || (i > 0 && r[i] == r[0]) || (i > 1 && r[i] == r[1]));
+    }
+
+    const Genome& parent = population[target];
+    Genome trial = parent;
+    int forced = static_cast<int>(rng.index(Dimensions));    // At least one gene comes from the mutant
+    for (int d = 0; d < Dimensions; d++) {
+        if (d == forced || rng.uniform() < opt.DECrossover) {
+            double x = population[r[0]][d] + opt.DEWeight * (population[r[1]][d] - population[r[2]][d]);
+            if (x < 0.0) x = 0.5 * parent[d];
+            if (x > 1.0) x = 0.5 * (parent[d] + 1.0);
+            trial[d] = x;
+        }
+    }
+    return trial;
+}
+
+QString DifferentialEvolution::engineName() const {
+    return "Differential Evolution";
+}
+
+QString DifferentialEvolution::engineReport() const {
+    QString report;
+    report += QString("Generations: %1\n").arg(opt.GenNum);
+    report += QString("Population Size: %1\n").arg(members);
+    report += QString("Differential Weight: %1, Crossover Rate: %2\n").arg(opt.DEWeight).arg(opt.DECrossover);
+    report += QString("Multi-start Guesses: %1\n").arg(opt.MultiStarts);
+    report += QString("Random Seed: %1\n").arg(static_cast<qulonglong>(seed));
+    report += QString("Solver Calls: %1\n").arg(runStatistics().solverCalls);
+    report += QString("Trials Accepted: %1\n").arg(trialsAccepted);
+    report += stoppingReport(stagnation);
+    return report;
+}
+
+void DifferentialEvolution::run() {
+    // --- 1. INITIALIZATION ---
+    progress.start(100.0 / ((opt.GenNum + 1) * members));
+    cancellation->start(opt.TimeBudget);
+    scheduler->resetStats();
+    stagnation = StagnationMonitor(opt);
+    trialsAccepted = 0;
+    seed = drawSeed();
+
+    // --- 2. INITIAL POPULATION ---
+    // A Sobol design, every member is kept even if it did not converge (zero fitness)
+    CounterRng shiftRng(seed, 0, 0, 0, SamplingShift);
+    SobolSequence sobol(Dimensions, shiftRng);
+    vector<Genome> genomes(members);
+    vector<Individual> population(members);
+    Individual velocity = coldVelocity();
+    for (int i = 0; i < members; i++) {
+        sobol.next(genomes[i].data());
+        population[i] = decodeGenome(genomes[i].data(), velocity);
+    }
+    solveBatch(population);
+
+    Individual best;
+    vector<double> fitness(members), delta(members);
+    auto track = [&]() {
+        for (int i = 0; i < members; i++) {
+            fitness[i] = population[i].fitness;
+            delta[i] = population[i].delta;
+            if (population[i].fitness > best.fitness) {
+                best = population[i];
+            }
+        }
+    };
+    track();
+    stagnation.update(0, fitness.data(), delta.data(), members);
+
+    // --- 3. GENERATIONAL LOOP ---
+    vector<Genome> trials(members);
+    vector<Individual> batch(members);
+    for (int gen = 1; gen <= opt.GenNum && !stopRequested(); gen++) {
+        velocity = best.fitness > 0 ? best : coldVelocity();
+        for (int i = 0; i < members; i++) {
+            trials[i] = trialGenome(genomes, i, gen);
+            batch[i] = decodeGenome(trials[i].data(), velocity);
+        }
+        solveBatch(batch);
+        if (stopRequested()) break;
+
+        // Greedy selection, ties go to the trial so the population keeps moving on plateaus
+        for (int i = 0; i < members; i++) {
+            if (batch[i].fitness >= population[i].fitness) {
+                population[i] = batch[i];
+                genomes[i] = trials[i];
+                trialsAccepted++;
+            }
+        }
+        track();
+        if (stagnation.update(gen, fitness.data(), delta.data(), members)) {
+            break;
+        }
+        progress.setStep(100.0 / ((stagnation.estimatedEnd(opt.GenNum) + 1) * members));
+    }
+
+    // --- 4. RESULTS ---
+    noSolution = best.fitness <= 0;
+    if (noSolution) {
+        emit summaryReady(generateSummary(Individual()));
+        emit progressChanged(100);
+        emit finished();
+        return;
+    }
+
+    bestIndividual = best;
+    QString summary = generateSummary(bestIndividual);
+    emit optimizationFinished(bestIndividual);
+    emit progressChanged(100);
+    emit summaryReady(summary + storeResult());
+    emit finished();
+}
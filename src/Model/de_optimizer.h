@@ -0,0 +1,57 @@
+#ifndef DEOPTIMIZER_H
+#define DEOPTIMIZER_H
+#pragma once
+
+#include "src/model/eqn_solver.h"
+#include "src/model/optimizer_engine.h"
+#include "src/controller/simulation_inputs.h"
+#include "src/Model/stagnation_monitor.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class DifferentialEvolution
+ * @brief DE/rand/1/bin over delta and the four slip guesses.
+ *
+ * The genome is scaled to the unit hypercube and the initial population is a Sobol design.
+ * Every generation builds one trial per member from three other random members
+ * (x_r1 + F (x_r2 - x_r3), binomial crossover with probability CR), solves all the trials in
+ * parallel with solveBatch() and keeps each trial that is at least as fast as its parent.
+ * Coordinates that leave the bounds are moved halfway between the parent and the bound.
+ */
+
+class DifferentialEvolution : public OptimizerEngine {
+    Q_OBJECT
+public:
+    static constexpr int Dimensions = 5;    //!< delta, alpha_f, alpha_r, kappa_f, kappa_r
+    using Genome = std::array<double, Dimensions>;
+
+    /**
+     * @brief Constructor for the DifferentialEvolution class.
+     * @param vehicle The Vehicle object with fixed parameters.
+     * @param optIN The OptimizationConfig, PopSize is the number of members (at least 4).
+     * @param solIN The SolverConfig for the equation solver.
+     */
+    DifferentialEvolution(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN);
+
+    /**
+     * @brief The main entry point to start the optimization.
+     */
+    void run() override;
+
+protected:
+    QString engineName() const override;
+    QString engineReport() const override;
+
+private:
+    Genome trialGenome(const std::vector<Genome>& members, int target, int generation) const;  //!< Mutation and crossover of one member.
+
+    int members;                        //!< Population size
+    uint64_t seed = 0;                  //!< Seed of the run, the trials are keyed by (seed, generation, member)
+    size_t trialsAccepted = 0;          //!< Trials that replaced their parent
+    StagnationMonitor stagnation;       //!< Early termination criteria shared with the genetic algorithm
+};
+
+#endif
@@ -0,0 +1,124 @@
+#include "src/Model/engine_benchmark.h"
+#include "src/Model/optimizer_engine.h"
+
+#include <QElapsedTimer>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+using namespace std;
+
+namespace {
+    // Fraction of the best known speed that counts as reaching the optimum
+    const double TargetRatio = 0.995;
+
+    struct EngineEntry {
+        OptimizerType type;
+        QString name;
+        bool memetic;       // Local search on the elites (Genetic engine)
+        bool adaptive;      // 1/5th success rule on the operators (Genetic engine)
+    };
+
+    const EngineEntry Engines[] = {
+        {OptimizerType::Genetic, "Genetic", false, false},
+        {OptimizerType::Genetic, "Genetic + memetic", true, false},
+        {OptimizerType::Genetic, "Genetic + adaptive", false, true},
+        {OptimizerType::Brent, "Brent", false, false},
+        {OptimizerType::CMAES, "CMA-ES", false, false},
+        {OptimizerType::DifferentialEvolution, "DE", false, false},
+    };
+
+    struct EngineRun {
+        BenchmarkResult result;
+        vector<BestImprovement> history;
+    };
+}
+
+vector<BenchmarkCase> defaultBenchmarkSuite() {
+    vector<BenchmarkCase> suite;
+    for (double m : {1200.0, 1600.0}) {
+        for (double R : {10.0, 25.0, 50.0, 100.0}) {
+            Vehicle veh(R, 1.2, 1.6, m, 0.0, 0.32, 1.0, 0.001);
+            setDefaultTires(veh.FrontTire, veh.RearTire);
+            suite.push_back({QString("m=%1 R=%2").arg(m).arg(R), veh});
+        }
+    }
+    return suite;
+}
+
+vector<BenchmarkResult> runEngineBenchmark(const vector<BenchmarkCase>& suite, OptimizationConfig opt, SolverConfig sol) {
+    vector<BenchmarkResult> results;
+    for (const BenchmarkCase& bc : suite) {
+        vector<EngineRun> runs;
+        double bestKnown = 0.0;
+        for (const EngineEntry& entry : Engines) {
+            opt.engine = entry.type;
+            opt.Memetic = entry.memetic;
+            opt.AdaptiveOperators = entry.adaptive;
+            unique_ptr<OptimizerEngine> engine(OptimizerEngine::create(bc.veh, opt, sol));
+
+            QElapsedTimer timer;
+            timer.start();
+            engine->run();
+
+            EngineRun run;
+            run.result.caseName = bc.name;
+            run.result.engine = entry.name;
+            run.result.wallTime = timer.nsecsElapsed() * 1e-9;
+            run.result.bestFitness = engine->noSolution ? 0.0 : engine->bestIndividual.fitness;
+            run.result.solverCalls = engine->runStatistics().solverCalls;
+            run.history = engine->bestHistory();
+            bestKnown = max(bestKnown, run.result.bestFitness);
+            runs.push_back(run);
+        }
+
+        // The target is only known once every engine has run
+        double target = TargetRatio * bestKnown;
+        for (EngineRun& run : runs) {
+            if (bestKnown > 0.0) {
+                auto hit = find_if(run.history.begin(), run.history.end(), [target](const BestImprovement& b) { return b.fitness >= target; });
+                if (hit != run.history.end()) {
+                    run.result.solvesToTarget = static_cast<long long>(hit->solverCalls);
+                    run.result.timeToTarget = hit->seconds;
+                }
+            }
+            results.push_back(run.result);
+        }
+    }
+    return results;
+}
+
+int benchmarkMain(const QString& csvPath) {
+    OptimizationConfig opt;
+    opt.GenNum = 40;
+    opt.PopSize = 20;
+    opt.Seed = 1;           // Every engine sees the same random streams on every case
+    SolverConfig sol;
+
+    vector<BenchmarkResult> results = runEngineBenchmark(defaultBenchmarkSuite(), opt, sol);
+
+    cout << "Case; Engine; Best (m/s); Solver calls; Solves to target; Time to target (s); Wall time (s)\n";
+    ofstream file;
+    if (!csvPath.isEmpty()) {
+        file.open(csvPath.toStdString());
+        if (!file) {
+            cerr << "Could not open " << csvPath.toStdString() << endl;
+            return 1;
+        }
+        file << "Case; Engine; Best (m/s); Solver calls; Solves to target; Time to target (s); Wall time (s)\n";
+    }
+    for (const BenchmarkResult& r : results) {
+        QString line = QString("%1; %2; %3; %4; %5; %6; %7\n")
+                           .arg(r.caseName, r.engine)
+                           .arg(r.bestFitness, 0, 'f', 4)
+                           .arg(r.solverCalls)
+                           .arg(r.solvesToTarget)
+                           .arg(r.timeToTarget, 0, 'f', 3)
+                           .arg(r.wallTime, 0, 'f', 3);
+        cout << line.toStdString();
+        if (file.is_open()) file << line.toStdString();
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#ifndef ENGINEBENCHMARK_H
+#define ENGINEBENCHMARK_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <QString>
+
+#include <vector>
+
+/**
+ * @struct BenchmarkCase
+ * @brief One vehicle and turn radius of the benchmark suite.
+ */
+
+struct BenchmarkCase {
+    QString name;       // Label written to the results
+    Vehicle veh;        // Vehicle, with the turn radius already set
+};
+
+/**
+ * @struct BenchmarkResult
+ * @brief Outcome of one engine on one case.
+ */
+
+struct BenchmarkResult {
+    QString caseName;
+    QString engine;
+    double bestFitness = 0.0;       // Best speed found [m/s]
+    size_t solverCalls = 0;         // Total solver calls of the run
+    long long solvesToTarget = -1;  // Solver calls when the target was first reached (-1 if never)
+    double timeToTarget = -1.0;     // Seconds when the target was first reached (-1 if never)
+    double wallTime = 0.0;          // Total run time [s]
+};
+
+/**
+ * @brief Default suite: the reference vehicle with a light and a heavy mass on several radii.
+ */
+std::vector<BenchmarkCase> defaultBenchmarkSuite();
+
+/**
+ * @brief Runs every optimizer engine on every case with the same seed and budget.
+ *
+ * The target of a case is 99.5% of the best speed found by any engine, so the results compare
+ * how many solver calls (and seconds) each engine needs to get close to the optimum.
+ * @param suite The cases to run.
+ * @param opt The common OptimizationConfig, engine is overwritten for each run.
+ * @param sol The SolverConfig for the equation solver.
+ * @return One result per case and engine.
+ */
+std::vector<BenchmarkResult> runEngineBenchmark(const std::vector<BenchmarkCase>& suite, OptimizationConfig opt, SolverConfig sol);
+
+/**
+ * @brief Command line entry point: runs the default suite, prints a table and writes a CSV file.
+ * @param csvPath Output file, semicolon separated like the other CSV outputs (empty skips the file).
+ * @return Process exit code.
+ */
+int benchmarkMain(const QString& csvPath);
+
+#endif
@@ -5,30 +5,110 @@
 #include <fstream>
 #include <vector>
 #include <cmath>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include <Eigen/Dense>
+#include "src/Model/task_scheduler.h"
+
+/**
+ * @brief Returns the fixed residual weights originally tuned for a 1600 kg car.
+ * The unknowns are not normalized with these scales.
+ * @return The legacy ResidualScales.
+ */
+
+ResidualScales legacyScales() {
+    return ResidualScales();
+}
+
+/**
+ * @brief Derives the residual weights and the characteristic magnitudes of the unknowns from the Vehicle.
+ * Forces are compared with the vehicle weight, the moment with the axle load moment, the front tire
+ * balance with the front normal load and the velocity constraint with the speed that a tire with
+ * the peak lateral friction could hold at the turn radius. Characteristic slip values are the slips
+ * at which the linear tire stiffness reaches the peak force.
+ * @param veh The Vehicle used in the simulation.
+ * @return The ResidualScales for this vehicle, or the legacy scales if the vehicle is not well defined.
+ */
+
+ResidualScales computeScales(const Vehicle& veh) {
+    double L = veh.a + veh.b;
+    double Fz_f = veh.m * g * veh.b / L;
+    double Fz_r = veh.m * g * veh.a / L;
+
+    // Peak friction and stiffness of a tire, from the Magic Formula coefficients
+    auto slipAtPeak = [](const PacejkaParams& p, double Fz, double& muY, double& alphaPeak, double& kappaPeak) {
+        double Fz0 = p.lambda_Fz0 * p.F_z0;
+        double df_z = (Fz - Fz0) / Fz0;
+        muY = std::abs((p.p_Dy1 + p.p_Dy2 * df_z) * p.lambda_muy);
+        double muX = std::abs((p.p_Dx1 + p.p_Dx2 * df_z) * p.lambda_mux);
+        double Ky = std::abs(p.p_Ky1 * Fz0 * std::sin(2.0 * std::atan(Fz / (p.p_Ky2 * Fz0))) * p.lambda_Ky);
+        double Kx = std::abs(Fz * (p.p_Kx1 + p.p_Kx2 * df_z) * std::exp(p.p_Kx3 * df_z) * p.lambda_Kx);
+        alphaPeak = muY * Fz / Ky;
+        kappaPeak = muX * Fz / Kx;
+    };
+
+    double muF, muR, alphaF, alphaR, kappaF, kappaR;
+    slipAtPeak(veh.FrontTire, Fz_f, muF, alphaF, kappaF);
+    slipAtPeak(veh.RearTire, Fz_r, muR, alphaR, kappaR);
+
+    ResidualScales scales;
+    double speed = std::sqrt(0.5 * (muF + muR) * g * veh.R);
+    scales.force = 1.0 / (veh.m * g);
+    scales.moment = 1.0 / (veh.m * g * veh.a * veh.b / L);
+    scales.tireForce = 1.0 / Fz_f;
+    scales.slipAngle = 0.5 * (alphaF + alphaR);
+    scales.slipRatio = 0.5 * (kappaF + kappaR);
+    scales.angle = 1.0 / scales.slipAngle;
+    scales.speed = speed;
+    scales.speedSq = 1.0 / (speed * speed);
+
+    // Degenerated vehicles (zero mass, missing tires, ...) keep the legacy scales
+    const double values[] = {scales.force, scales.moment, scales.tireForce, scales.angle, scales.speedSq,
+                             scales.slipAngle, scales.slipRatio, scales.speed};
+    for (double v : values) {
+        if (!std::isfinite(v) || v <= 0.0) {
+            return legacyScales();
+        }
+    }
+    return scales;
+}
+
+/**
+ * @brief Selects the adaptive or the legacy scales, following the SolverConfig.
+ * @param veh The Vehicle used in the simulation.
+ * @param sol The SolverConfig with the scaling option.
+ * @return The ResidualScales used by the solver.
+ */
+
+ResidualScales solverScales(const Vehicle& veh, const SolverConfig& sol) {
+    return sol.adaptiveScaling ? computeScales(veh) : legacyScales();
+}
 
 /**
  * @brief Sets the physically plausible upper and lower bounds for the solver's variables.
  * This prevents the solver from exploring unrealistic solutions.
  * @param problem The Ceres Problem object to which the bounds will be added.
- * @param ind The Individual whose guess variables will be bounded.
+ * @param x The normalized solver variables [alpha_F, alpha_R, kappa_F, kappa_R, V, Vx, Vy].
  * @param opt The Genetic Algorithm Config with the bouds to be configured.
+ * @param scales The characteristic magnitudes used to normalize the variables.
  */
 
-void setBoundaries (ceres::Problem& problem, Individual& ind, OptimizationConfig opt) {
-    problem.SetParameterLowerBound(&ind.alpha_F_guess, 0, opt.minAlphaf);  
-    problem.SetParameterUpperBound(&ind.alpha_F_guess, 0, opt.maxAlphaf);   
-    problem.SetParameterLowerBound(&ind.alpha_R_guess, 0, opt.minAlphar);
-    problem.SetParameterUpperBound(&ind.alpha_R_guess, 0, opt.maxAlphar);
-    problem.SetParameterLowerBound(&ind.kappa_F_guess, 0, opt.minKappaf);
-    problem.SetParameterUpperBound(&ind.kappa_F_guess, 0, opt.maxKappaf);
-    problem.SetParameterLowerBound(&ind.kappa_R_guess, 0, opt.minKappar);
-    problem.SetParameterUpperBound(&ind.kappa_R_guess, 0, opt.maxKappar);
-    problem.SetParameterLowerBound(&ind.V_guess, 0, 0.0);           // Speed >=0
-    problem.SetParameterUpperBound(&ind.V_guess, 0, 100.0);         // Max 100 m/s
-    problem.SetParameterLowerBound(&ind.Vx_guess, 0, 0.0);         // Forward speed >=0
-    problem.SetParameterUpperBound(&ind.Vx_guess, 0, 100.0);
-    problem.SetParameterLowerBound(&ind.Vy_guess, 0, -50.0);      
-    problem.SetParameterUpperBound(&ind.Vy_guess, 0, 50.0);
+void setBoundaries (ceres::Problem& problem, double* x, OptimizationConfig opt, const ResidualScales& scales) {
+    problem.SetParameterLowerBound(&x[0], 0, opt.minAlphaf / scales.slipAngle);
+    problem.SetParameterUpperBound(&x[0], 0, opt.maxAlphaf / scales.slipAngle);
+    problem.SetParameterLowerBound(&x[1], 0, opt.minAlphar / scales.slipAngle);
+    problem.SetParameterUpperBound(&x[1], 0, opt.maxAlphar / scales.slipAngle);
+    problem.SetParameterLowerBound(&x[2], 0, opt.minKappaf / scales.slipRatio);
+    problem.SetParameterUpperBound(&x[2], 0, opt.maxKappaf / scales.slipRatio);
+    problem.SetParameterLowerBound(&x[3], 0, opt.minKappar / scales.slipRatio);
+    problem.SetParameterUpperBound(&x[3], 0, opt.maxKappar / scales.slipRatio);
+    problem.SetParameterLowerBound(&x[4], 0, 0.0);                          // Speed >=0
+    problem.SetParameterUpperBound(&x[4], 0, 100.0 / scales.speed);         // Max 100 m/s
+    problem.SetParameterLowerBound(&x[5], 0, 0.0);                          // Forward speed >=0
+    problem.SetParameterUpperBound(&x[5], 0, 100.0 / scales.speed);
+    problem.SetParameterLowerBound(&x[6], 0, -50.0 / scales.speed);
+    problem.SetParameterUpperBound(&x[6], 0, 50.0 / scales.speed);
 }
 
 
@@ -51,13 +131,16 @@ bool checkResiduals(const Individual& ind, SolverConfig sol) {
 /**
  * @brief Manually re-evaluates the residual functor with the solver's final values.
  * This is a post-solve check to ensure the solution is physically valid and meets the convergence criteria.
+ * The tolerances are defined on the legacy-weighted residuals, so the check always uses legacyScales()
+ * on the physical values: the adaptive and the legacy scaling accept exactly the same solutions and only
+ * change the path the solver takes to reach them.
  * @param ind The Individual whose convergence status needs to be verified.
  * @param veh The Vehicle parameters used in the calculation.
  * @param sol The SolverConfig containing tolerance settings.
  */
 
 void verifyConvergence(Individual& ind, Vehicle& veh, SolverConfig sol){
-    ResidualFunctor functor(veh, ind);
+    ResidualFunctor functor(veh, ind, legacyScales());
 
     // Get residuals with the functor initialization
     functor(&ind.alpha_F_guess, &ind.alpha_R_guess, &ind.kappa_F_guess, &ind.kappa_R_guess, &ind.V_guess, &ind.Vx_guess, &ind.Vy_guess, ind.residuals.data());
@@ -104,11 +187,11 @@ void computeIndividualResults(Individual& ind, Vehicle& veh, ceres::Solver::Summ
         ind.beta = atan2(ind.Vy, ind.Vx);
         ind.ay = (ind.fitness * ind.fitness) / veh.R;
         ind.F_D = 0.5 * rho * veh.Cd * veh.Af * ind.Vx * ind.Vx; 
-        ind.summary = summary;
         ind.converged = true;
         
     } else {
         ind.converged = false;
+        ind.fitness = 0.0;      // Clones keep the fitness of their parent until here
     }
 }
 
@@ -129,44 +212,306 @@ void configureSolver(ceres::Solver::Options& options, SolverConfig sol) {
 }
 
 /**
- * @brief The main function to solve the vehicle dynamics for a single Individual.
- * It sets up the Ceres problem, configures the solver, runs the solve, and processes the results.
- * @param ind A reference to the Individual to be solved.
+ * @brief Solves the full 7-unknown system, with all the kinematic constraints as residuals.
+ * @param ind A reference to the Individual to be solved, its guesses receive the solution.
  * @param veh A reference to the Vehicle parameters.
- * @param sol A reference to the SolverConfig.
- * @param opt A referencer to the OptimizationConfig.
+ * @param sol The SolverConfig.
+ * @param opt The OptimizationConfig with the variable bounds.
+ * @param scales The residual weights and variable normalization.
+ * @param summary Receives the Ceres summary of the solve.
+ * @param shouldAbort Optional condition checked at every iteration to cancel the solve.
  */
 
-void solveIndividual(Individual &ind, Vehicle &veh, SolverConfig sol, OptimizationConfig opt)
+static void solveFull(Individual &ind, Vehicle &veh, SolverConfig sol, OptimizationConfig opt, const ResidualScales& scales, ceres::Solver::Summary& summary,
+                      const std::function<bool()>& shouldAbort)
 {
+    // Normalized unknowns [alpha_F, alpha_R, kappa_F, kappa_R, V, Vx, Vy], clamped so the initial point is feasible.
+    double x[7] = {
+        clamp(ind.alpha_F_guess, opt.minAlphaf, opt.maxAlphaf) / scales.slipAngle,
+        clamp(ind.alpha_R_guess, opt.minAlphar, opt.maxAlphar) / scales.slipAngle,
+        clamp(ind.kappa_F_guess, opt.minKappaf, opt.maxKappaf) / scales.slipRatio,
+        clamp(ind.kappa_R_guess, opt.minKappar, opt.maxKappar) / scales.slipRatio,
+        clamp(ind.V_guess, 0.0, 100.0) / scales.speed,
+        clamp(ind.Vx_guess, 0.0, 100.0) / scales.speed,
+        clamp(ind.Vy_guess, -50.0, 50.0) / scales.speed
+    };
+
     // Set up the problem.
     ceres::Problem problem;
     ceres::LossFunction* loss = new ceres::HuberLoss(1.0);
-    ceres::Solver::Summary summary;
     ceres::Solver::Options options;
-    ceres::CostFunction* cost_function = new ceres::AutoDiffCostFunction<ResidualFunctor, 7, 1, 1, 1, 1, 1, 1, 1>(new ResidualFunctor(veh, ind));
+    ceres::CostFunction* cost_function = new ceres::AutoDiffCostFunction<NormalizedResidualFunctor, 7, 1, 1, 1, 1, 1, 1, 1>(new NormalizedResidualFunctor(veh, ind, scales));
 
     // Create the cost function using AutoDiff, specifying 7 residuals and 7 parameter blocks of size 1.
-    problem.AddResidualBlock(cost_function, loss, &ind.alpha_F_guess, &ind.alpha_R_guess, &ind.kappa_F_guess, &ind.kappa_R_guess, &ind.V_guess, &ind.Vx_guess, &ind.Vy_guess);
+    problem.AddResidualBlock(cost_function, loss, &x[0], &x[1], &x[2], &x[3], &x[4], &x[5], &x[6]);
 
     // Set parameter bounds.
-    setBoundaries(problem, ind, opt);
+    setBoundaries(problem, x, opt, scales);
     
     // Configure the solver.
     configureSolver(options, sol);
+    AbortCallback abortCallback(shouldAbort);
+    if (shouldAbort) {
+        options.callbacks.push_back(&abortCallback);
+    }
 
     // Run the solver.
     Solve(options, &problem, &summary);
 
-    // Verify convergence and compute final results.
+    // Back to physical units
+    ind.alpha_F_guess = x[0] * scales.slipAngle;
+    ind.alpha_R_guess = x[1] * scales.slipAngle;
+    ind.kappa_F_guess = x[2] * scales.slipRatio;
+    ind.kappa_R_guess = x[3] * scales.slipRatio;
+    ind.V_guess = x[4] * scales.speed;
+    ind.Vx_guess = x[5] * scales.speed;
+    ind.Vy_guess = x[6] * scales.speed;
+}
+
+/**
+ * @brief Solves the reduced 4-unknown system, where the slip angles and V come from the kinematics.
+ * The slip angle guesses of the Individual are not used, after the solve they receive the
+ * slip angles consistent with the solved velocities.
+ * @param ind A reference to the Individual to be solved, its guesses receive the solution.
+ * @param veh A reference to the Vehicle parameters.
+ * @param sol The SolverConfig.
+ * @param opt The OptimizationConfig with the variable bounds.
+ * @param scales The residual weights and variable normalization.
+ * @param summary Receives the Ceres summary of the solve.
+ * @param shouldAbort Optional condition checked at every iteration to cancel the solve.
+ */
+
+static void solveReduced(Individual &ind, Vehicle &veh, SolverConfig sol, OptimizationConfig opt, const ResidualScales& scales, ceres::Solver::Summary& summary,
+                      const std::function<bool()>& shouldAbort)
+{
+    // Normalized unknowns [kappa_F, kappa_R, Vx, Vy], clamped so the initial point is feasible.
+    double x[4] = {
+        clamp(ind.kappa_F_guess, opt.minKappaf, opt.maxKappaf) / scales.slipRatio,
+        clamp(ind.kappa_R_guess, opt.minKappar, opt.maxKappar) / scales.slipRatio,
+        clamp(ind.Vx_guess, 0.0, 100.0) / scales.speed,
+        clamp(ind.Vy_guess, -50.0, 50.0) / scales.speed
+    };
+
+    // Set up the problem.
+    ceres::Problem problem;
+    ceres::LossFunction* loss = new ceres::HuberLoss(1.0);
+    ceres::Solver::Options options;
+    ceres::CostFunction* cost_function = new ceres::AutoDiffCostFunction<ReducedResidualFunctor, 4, 1, 1, 1, 1>(new ReducedResidualFunctor(veh, ind, scales));
+    problem.AddResidualBlock(cost_function, loss, &x[0], &x[1], &x[2], &x[3]);
+
+    // Set parameter bounds, the slip angle bounds are checked after the solve.
+    problem.SetParameterLowerBound(&x[0], 0, opt.minKappaf / scales.slipRatio);
+    problem.SetParameterUpperBound(&x[0], 0, opt.maxKappaf / scales.slipRatio);
+    problem.SetParameterLowerBound(&x[1], 0, opt.minKappar / scales.slipRatio);
+    problem.SetParameterUpperBound(&x[1], 0, opt.maxKappar / scales.slipRatio);
+    problem.SetParameterLowerBound(&x[2], 0, 0.0);                          // Forward speed >=0
+    problem.SetParameterUpperBound(&x[2], 0, 100.0 / scales.speed);
+    problem.SetParameterLowerBound(&x[3], 0, -50.0 / scales.speed);
+    problem.SetParameterUpperBound(&x[3], 0, 50.0 / scales.speed);
+
+    // Configure and run the solver.
+    configureSolver(options, sol);
+    AbortCallback abortCallback(shouldAbort);
+    if (shouldAbort) {
+        options.callbacks.push_back(&abortCallback);
+    }
+    Solve(options, &problem, &summary);
+
+    // Back to physical units, and map the eliminated unknowns into the Individual
+    ind.kappa_F_guess = x[0] * scales.slipRatio;
+    ind.kappa_R_guess = x[1] * scales.slipRatio;
+    ind.Vx_guess = x[2] * scales.speed;
+    ind.Vy_guess = x[3] * scales.speed;
+    kinematicSlips(veh, ind.delta, ind.Vx_guess, ind.Vy_guess, ind.V_guess, ind.alpha_F_guess, ind.alpha_R_guess);
+}
+
+/**
+ * @brief The main function to solve the vehicle dynamics for a single Individual.
+ * It sets up the Ceres problem with the formulation selected at SolverConfig, runs the solve, and processes the results.
+ * @param ind A reference to the Individual to be solved.
+ * @param veh A reference to the Vehicle parameters.
+ * @param sol A reference to the SolverConfig.
+ * @param opt A referencer to the OptimizationConfig.
+ * @param shouldAbort Optional condition checked at every solver iteration, the solve is abandoned when it returns true.
+ * @param fullSummary Optional pointer that receives the full Ceres summary, only the compact SolveStats are kept in the Individual.
+ */
+
+void solveIndividual(Individual &ind, Vehicle &veh, SolverConfig sol, OptimizationConfig opt, const std::function<bool()>& shouldAbort,
+                     ceres::Solver::Summary* fullSummary)
+{
+    ResidualScales scales = solverScales(veh, sol);
+    ceres::Solver::Summary summary;
+
+    if (sol.formulation == SolverFormulation::Reduced) {
+        solveReduced(ind, veh, sol, opt, scales, summary, shouldAbort);
+    } else {
+        solveFull(ind, veh, sol, opt, scales, summary, shouldAbort);
+    }
+
+    // Keep only the compact statistics in the Individual
+    ind.stats.iterations = static_cast<int>(summary.iterations.size());
+    ind.stats.finalCost = summary.final_cost;
+    ind.stats.termination = summary.termination_type;
+    ind.stats.solveTime = summary.total_time_in_seconds;
+    if (fullSummary) {
+        *fullSummary = summary;
+    }
+
+    // Verify convergence of all 7 equations and compute final results.
     verifyConvergence(ind, veh, sol);
 
+    // The reduced formulation does not bound the slip angles inside the solver
+    if (ind.converged && sol.formulation == SolverFormulation::Reduced) {
+        if (ind.alpha_F_guess < opt.minAlphaf || ind.alpha_F_guess > opt.maxAlphaf ||
+            ind.alpha_R_guess < opt.minAlphar || ind.alpha_R_guess > opt.maxAlphar) {
+            ind.converged = false;
+            ind.fitness = 0.0;
+        }
+    }
+
     if (ind.converged) {
         computeIndividualResults(ind, veh, summary);
     }
     
 }
 
+/**
+ * @brief Moves the solver initial guesses of a start to a deterministic point of the guess space.
+ * The points follow a Kronecker (additive recurrence) sequence, so K starts cover the bounds
+ * evenly without a random number generator shared between threads.
+ * @param ind The Individual whose guesses are replaced.
+ * @param k The index of the start.
+ * @param opt The OptimizationConfig with the guess bounds.
+ */
+
+static void diversifyGuess(Individual& ind, int k, const OptimizationConfig& opt) {
+    auto frac = [k](double step) { return std::fmod(0.5 + k * step, 1.0); };
+    ind.alpha_F_guess = opt.minAlphaf + (opt.maxAlphaf - opt.minAlphaf) * frac(0.41421356237);     // sqrt(2) - 1
+    ind.alpha_R_guess = opt.minAlphar + (opt.maxAlphar - opt.minAlphar) * frac(0.73205080757);     // sqrt(3) - 1
+    ind.kappa_F_guess = opt.minKappaf + (opt.maxKappaf - opt.minKappaf) * frac(0.23606797750);     // sqrt(5) - 2
+    ind.kappa_R_guess = opt.minKappar + (opt.maxKappar - opt.minKappar) * frac(0.64575131106);     // sqrt(7) - 2
+    ind.V_guess = 5.0 + 35.0 * frac(0.61803398875);                                               // golden ratio
+    double beta = 0.1 * (2.0 * frac(0.31662479036) - 1.0);                                        // sqrt(11) - 3
+    ind.Vx_guess = ind.V_guess * std::cos(beta);
+    ind.Vy_guess = ind.V_guess * std::sin(beta);
+}
+
+/**
+ * @brief Solves an Individual from K initial guesses at the same time.
+ * Start 0 keeps the Individual's own guesses and runs on the calling thread, the other starts are
+ * diversified with diversifyGuess() and run as nested tasks of the current TaskScheduler. The converged start with the
+ * lowest index wins, so the result does not depend on thread timing, and every start with a higher
+ * index is aborted through an AbortCallback as soon as a lower one converges.
+ * @param ind The Individual to be solved, it receives the winning start.
+ * @param veh A reference to the Vehicle parameters.
+ * @param sol The SolverConfig.
+ * @param opt The OptimizationConfig with the guess bounds.
+ * @param K The number of starts, 1 solves only the Individual's own guesses.
+ * @param shouldAbort Optional condition checked at every solver iteration of every start, e.g. a user stop request.
+ * @return true if one of the starts converged.
+ */
+
+bool solveMultiStart(Individual& ind, Vehicle& veh, SolverConfig sol, OptimizationConfig opt, int K, const std::function<bool()>& shouldAbort) {
+    if (K <= 1) {
+        solveIndividual(ind, veh, sol, opt, shouldAbort);
+        return ind.converged;
+    }
+
+    std::vector<Individual> starts(K, ind);
+    for (int k = 1; k < K; k++) {
+        diversifyGuess(starts[k], k, opt);
+    }
+
+    std::atomic<int> winner(K);     // Lowest converged index, K while none converged
+
+    auto solveStart = [&](int k) {
+        // A start can only win while no lower index has converged
+        if (winner.load() > k && !(shouldAbort && shouldAbort())) {
+            solveIndividual(starts[k], veh, sol, opt, [&winner, &shouldAbort, k]() { return winner.load() < k || (shouldAbort && shouldAbort()); });
+            if (starts[k].converged) {
+                int current = winner.load();
+                while (k < current && !winner.compare_exchange_weak(current, k)) {}
+            }
+        }
+    };
+
+    // Inside a population evaluation the starts go to the worker's own deque, idle workers steal them
+    TaskGroup group;
+    for (int k = 1; k < K; k++) {
+        group.run([&solveStart, k]() { solveStart(k); });
+    }
+    solveStart(0);
+    group.wait();
+
+    int best = winner.load();
+    ind = starts[(best < K) ? best : 0];
+    return best < K;
+}
+
+/**
+ * @brief Condition number of the square Jacobian of a cost function whose parameter blocks all have size 1.
+ * @param cost The cost function, with n residuals and n parameter blocks.
+ * @param x The n normalized unknowns at which the Jacobian is evaluated.
+ * @param n The size of the system.
+ * @return The ratio between the largest and smallest singular values, infinity if the Jacobian is singular.
+ */
+
+static double conditionNumber(const ceres::CostFunction& cost, const double* x, int n) {
+    std::vector<const double*> parameters(n);
+    std::vector<double> residuals(n);
+    std::vector<double> columns(n * n);
+    std::vector<double*> jacobians(n);
+    for (int i = 0; i < n; i++) {
+        parameters[i] = &x[i];
+        jacobians[i] = &columns[i * n];
+    }
+
+    if (!cost.Evaluate(parameters.data(), residuals.data(), jacobians.data())) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // Each parameter block has size 1, so every block is one column of the Jacobian
+    Eigen::MatrixXd J(n, n);
+    for (int col = 0; col < n; col++) {
+        for (int row = 0; row < n; row++) {
+            J(row, col) = columns[col * n + row];
+        }
+    }
+
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(J);
+    double sMax = svd.singularValues()(0);
+    double sMin = svd.singularValues()(n - 1);
+    return (sMin > 0.0) ? sMax / sMin : std::numeric_limits<double>::infinity();
+}
+
+/**
+ * @brief Computes the condition number of the normalized Jacobian at the Individual's solution.
+ * A large value means that some directions barely change the residuals, which slows down
+ * Levenberg-Marquardt and makes the solution sensitive to the tolerances. The Jacobian is the one
+ * of the system the solver actually ran: 7x7 for the full formulation, 4x4 for the reduced one.
+ * @param ind The solved Individual.
+ * @param veh The Vehicle parameters used in the calculation.
+ * @param sol The SolverConfig with the formulation and the scaling used by the solver.
+ * @return The ratio between the largest and smallest singular values of the Jacobian.
+ */
+
+double jacobianConditionNumber(const Individual& ind, const Vehicle& veh, const SolverConfig& sol) {
+    ResidualScales scales = solverScales(veh, sol);
+
+    if (sol.formulation == SolverFormulation::Reduced) {
+        ceres::AutoDiffCostFunction<ReducedResidualFunctor, 4, 1, 1, 1, 1> cost(new ReducedResidualFunctor(veh, ind, scales));
+        double x[4] = {ind.kappa_F_guess / scales.slipRatio, ind.kappa_R_guess / scales.slipRatio,
+                       ind.Vx_guess / scales.speed, ind.Vy_guess / scales.speed};
+        return conditionNumber(cost, x, 4);
+    }
+
+    ceres::AutoDiffCostFunction<NormalizedResidualFunctor, 7, 1, 1, 1, 1, 1, 1, 1> cost(new NormalizedResidualFunctor(veh, ind, scales));
+    double x[7] = {ind.alpha_F_guess / scales.slipAngle, ind.alpha_R_guess / scales.slipAngle,
+                   ind.kappa_F_guess / scales.slipRatio, ind.kappa_R_guess / scales.slipRatio,
+                   ind.V_guess / scales.speed, ind.Vx_guess / scales.speed, ind.Vy_guess / scales.speed};
+    return conditionNumber(cost, x, 7);
+}
+
 void testsolver(){
     Vehicle veh;
     SolverConfig sol;
@@ -240,7 +585,7 @@ void testsolver(){
             std::cout << "Solver converged for delta = " << radToDegree(i) << " with fitness = " << ind.fitness << " m/s and Vy = " << ind.Vy << std::endl;
             std::cout << "Residuals: ";
             for (const auto& res : ind.residuals) { std::cout << res << " "; }
-            std::cout << "Number of Iteratios" << ind.summary.iterations.size()<< std::endl;
+            std::cout << "Number of Iteratios" << ind.stats.iterations << std::endl;
         }
     }
     */
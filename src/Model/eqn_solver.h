@@ -3,9 +3,106 @@
 
 #include "src/controller/simulation_inputs.h"
 #include <ceres/ceres.h>
+#include <functional>
 
 using namespace ceres;
 
+/**
+ * @struct ResidualScales
+ * @brief Weights applied to each residual and characteristic magnitudes of the solver unknowns.
+ * Residuals are divided by the force, moment and speed magnitudes of the current Vehicle, so all
+ * of them are dimensionless and of the same order. The unknowns are solved normalized by their
+ * characteristic magnitude, which keeps the Jacobian columns balanced.
+ */
+
+struct ResidualScales {
+    double force = 1.0 / 1000.0;    // Weight of the force balances (residuals 0 and 1)
+    double moment = 1.0 / 1000.0;   // Weight of the moment balance (residual 2)
+    double tireForce = 1.0 / 10.0;  // Weight of the front tire longitudinal balance (residual 3)
+    double angle = 100.0;           // Weight of the slip angle constraints (residuals 4 and 5)
+    double speedSq = 1.0 / 100.0;   // Weight of the velocity constraint (residual 6)
+
+    double slipAngle = 1.0;         // Characteristic slip angle [rad] used to normalize alpha_f and alpha_r
+    double slipRatio = 1.0;         // Characteristic slip ratio [-] used to normalize kappa_f and kappa_r
+    double speed = 1.0;             // Characteristic speed [m/s] used to normalize V, Vx and Vy
+};
+
+//! Fixed scales originally tuned for a 1600 kg car, without variable normalization.
+ResidualScales legacyScales();
+
+//! Scales derived from the mass, geometry, turn radius and tire parameters of the Vehicle.
+ResidualScales computeScales(const Vehicle& veh);
+
+//! Returns the scales used by the solver for the given configuration.
+ResidualScales solverScales(const Vehicle& veh, const SolverConfig& sol);
+
+/**
+ * @brief Calculates the force and moment balance residuals shared by every solver formulation.
+ * @tparam T The numeric type, which will be `double` for evaluation or `ceres::Jet` for automatic differentiation.
+ * @param veh The Vehicle's fixed parameters.
+ * @param delta The wheel steering angle.
+ * @param scales The weights applied to each residual.
+ * @param residuals Pointer to an array where the 4 balance residuals will be stored.
+ */
+
+template <typename T>
+void balanceResiduals(const Vehicle& veh, double delta, const ResidualScales& scales,
+                      const T& alpha_f, const T& alpha_r, const T& kappa_f, const T& kappa_r,
+                      const T& V, const T& V_x, const T& V_y, T* residuals) {
+    // Helpers
+    T r = V / T(veh.R);                                                     // Yaw Velocity Definition
+    T cos_delta = ceres::cos(T(delta));                                     // Facilities to use cos and sin of delta with ceres
+    T sin_delta = ceres::sin(T(delta));
+    T F_D = T(0.5) * T(rho) * T(veh.Cd) * T(veh.Af) * (V_x * V_x);          // Aerodynamic Drag equation
+    T gamma = T(veh.gamma_w);                                               // Definition of gamma as a type T
+
+    T Fz_f = T(veh.m * g * veh.b / (veh.a + veh.b));                        // Front Normal load calculation
+    T Fz_r = T(veh.m * g * veh.a / (veh.a + veh.b));                        // Rear Normal load calculation
+
+    T Fres_f = -T(veh.f_r_F) * Fz_f;                                        // Rolling Resistance on front tire
+
+    // Tire forces calculations with Magic Formula
+    T Fx_f = calculateCombinedLongitudinalForce(veh.FrontTire, Fz_f, alpha_f, kappa_f, gamma);
+    T Fy_f = calculateCombinedLateralForce(veh.FrontTire, Fz_f, alpha_f, kappa_f, gamma);
+    T Mz_f = calculateCombinedAligningMoment(veh.FrontTire, Fz_f, alpha_f, kappa_f, gamma);
+    T Fx_r = calculateCombinedLongitudinalForce(veh.RearTire, Fz_r, alpha_r, kappa_r, gamma);
+    T Fy_r = calculateCombinedLateralForce(veh.RearTire, Fz_r, alpha_r, kappa_r, gamma);
+    T Mz_r = calculateCombinedAligningMoment(veh.RearTire, Fz_r, alpha_r, kappa_r, gamma);
+
+    // Scales to use on residuals equations, this aims to improve the solver quality, mantaining all residuals in the same magnitud
+
+    T reScale1 = T(scales.force);       // Scale the residuals 0 and 1 to improve numerical stability
+    T reScale3 = T(scales.moment);      // Scale the residual 2 to improve numerical stability
+    T reScale4 = T(scales.tireForce);   // Scale the residual 3 to improve numerical stability
+
+    // Equations
+    residuals[0] = (Fx_f * cos_delta - Fy_f * sin_delta + Fx_r - F_D + T(veh.m) * V_y * r) * reScale1;     // Longitudinal force balance
+    residuals[1] = (Fx_f * sin_delta + Fy_f * cos_delta + Fy_r - T(veh.m) * V_x * r) * reScale1;           // Lateral force balance
+    residuals[2] = (T(veh.a) * (Fx_f * sin_delta + Fy_f * cos_delta) - T(veh.b) * Fy_r + Mz_f + Mz_r) * reScale3;  // Moment balance
+    residuals[3] = (Fx_f - Fres_f) * reScale4;  // Front longitudinal force balance at the tire -> used to find kappa_f here
+}
+
+/**
+ * @brief Calculates the total velocity and the slip angles that satisfy the kinematic constraints.
+ * These are the quantities that residuals 4, 5 and 6 of ResidualFunctor enforce implicitly.
+ * @tparam T The numeric type.
+ * @param veh The Vehicle's fixed parameters.
+ * @param delta The wheel steering angle.
+ * @param V_x The longitudinal velocity.
+ * @param V_y The lateral velocity.
+ * @param V Receives the total velocity.
+ * @param alpha_f Receives the front slip angle.
+ * @param alpha_r Receives the rear slip angle.
+ */
+
+template <typename T>
+void kinematicSlips(const Vehicle& veh, double delta, const T& V_x, const T& V_y, T& V, T& alpha_f, T& alpha_r) {
+    V = ceres::sqrt(V_x * V_x + V_y * V_y + T(1e-12));     // Small offset keeps the derivative finite at rest
+    T r = V / T(veh.R);
+    alpha_f = T(delta) - ceres::atan((V_y + T(veh.a) * r) / (V_x + T(1e-6)));
+    alpha_r = -ceres::atan((V_y - T(veh.b) * r) / (V_x + T(1e-6)));
+}
+
 /**
  * @struct ResidualFunctor
  * @brief A Ceres cost functor that calculates the residuals for the vehicle dynamics equations.
@@ -18,8 +115,9 @@ struct ResidualFunctor {
      * @brief Constructor for the ResidualFunctor.
      * @param v A constant reference to the Vehicle's fixed parameters.
      * @param ind A constant reference to the Individual's current state (used for delta).
+     * @param scales The weights applied to each residual.
      */
-    ResidualFunctor(const Vehicle& v,const Individual& ind) : veh_(v), ind_(ind) {}
+    ResidualFunctor(const Vehicle& v,const Individual& ind, const ResidualScales& scales = legacyScales()) : veh_(v), ind_(ind), scales_(scales) {}
 
     /**
      * @brief The core evaluation function called by Ceres Solver.
@@ -39,40 +137,14 @@ struct ResidualFunctor {
     template <typename T>
     bool operator()(const T* alpha_f, const T* alpha_r, const T* kappa_f, const T* kappa_r,
                     const T* V, const T* V_x, const T* V_y, T* residuals) const {
-        tireInputs<double> tire;
-
-        // Helpers
-        T r = *V / T(veh_.R);                                                   // Yaw Velocity Definition      
-        T cos_delta = ceres::cos(T(ind_.delta));                                // Facilities to use cos and sin of delta with ceres
-        T sin_delta = ceres::sin(T(ind_.delta));
-        T F_D = T(0.5) * T(rho) * T(veh_.Cd) * T(veh_.Af) * (*V_x * *V_x);      // Aerodynamic Drag equation
-        T gamma = T(veh_.gamma_w);                                              // Definition of gamma as a type T
-
-        T Fz_f = T(veh_.m * g * veh_.b / (veh_.a + veh_.b));                    // Front Normal load calculation
-        T Fz_r = T(veh_.m * g * veh_.a / (veh_.a + veh_.b));                    // Rear Normal load calculation
-        
-        T Fres_f = -T(veh_.f_r_F) * Fz_f;                                       // Rolling Resistance on front tire
-
-        // Tire forces calculations with Magic Formula
-        T Fx_f = calculateCombinedLongitudinalForce(veh_.FrontTire, Fz_f, *alpha_f, *kappa_f, gamma);
-        T Fy_f = calculateCombinedLateralForce(veh_.FrontTire, Fz_f, *alpha_f, *kappa_f, gamma);
-        T Mz_f = calculateCombinedAligningMoment(veh_.FrontTire, Fz_f, *alpha_f, *kappa_f, gamma);
-        T Fx_r = calculateCombinedLongitudinalForce(veh_.RearTire, Fz_r, *alpha_r, *kappa_r, gamma);
-        T Fy_r = calculateCombinedLateralForce(veh_.RearTire, Fz_r, *alpha_r, *kappa_r, gamma);
-        T Mz_r = calculateCombinedAligningMoment(veh_.RearTire, Fz_r, *alpha_r, *kappa_r, gamma);
-
-        // Scales to use on residuals equations, this aims to improve the solver quality, mantaining all residuals in the same magnitud
-
-        T reScale1 = T (1.0 / (1000)); // Scale the residuals 0, 1 and 2 to improve numerical stability
-        T reScale4 = T (1.0 / (10)); // Scale the residual 3 to improve numerical stability
-        T reScale5 = T (100.0); // Scale the residuals 4 and 5 to improve numerical stability
-        T reScale7 = T (1.0 / (100.0)); // Scale the residual 6 to improve numerical stability
-
-        // Equations
-        residuals[0] = (Fx_f * cos_delta - Fy_f * sin_delta + Fx_r - F_D + T(veh_.m) * (*V_y) * r) * reScale1;  // Longitudinal force balance
-        residuals[1] = (Fx_f * sin_delta + Fy_f * cos_delta + Fy_r - T(veh_.m) * (*V_x) * r) * reScale1;    // Lateral force balance
-        residuals[2] = (T(veh_.a) * (Fx_f * sin_delta + Fy_f * cos_delta) - T(veh_.b) * Fy_r + Mz_f + Mz_r) * reScale1;   // Moment balance
-        residuals[3] = (Fx_f - Fres_f) * reScale4;  // Front longitudinal force balance at the tire -> used to find kappa_f here
+        // Force and moment balances
+        balanceResiduals(veh_, ind_.delta, scales_, *alpha_f, *alpha_r, *kappa_f, *kappa_r, *V, *V_x, *V_y, residuals);
+
+        T r = *V / T(veh_.R);                   // Yaw Velocity Definition
+        T reScale5 = T(scales_.angle);          // Scale the residuals 4 and 5 to improve numerical stability
+        T reScale7 = T(scales_.speedSq);        // Scale the residual 6 to improve numerical stability
+
+        // Kinematic constraints
         residuals[4] = (*alpha_f - (T(ind_.delta) - ceres::atan((*V_y + T(veh_.a) * r) / (*V_x + 1e-6)))) * reScale5;  // Front slip angle constraint 
         residuals[5] = (*alpha_r + ceres::atan((*V_y - T(veh_.b) * r) / (*V_x + 1e-6))) * reScale5; // Rear slip angle constraint
         residuals[6] = ((*V) * (*V) - (*V_x) * (*V_x) - (*V_y) * (*V_y)) * reScale7;    // Velocity constraint
@@ -83,19 +155,106 @@ struct ResidualFunctor {
 private:
     const Vehicle& veh_;
     const Individual& ind_;
+    ResidualScales scales_;
+};
+
+/**
+ * @struct NormalizedResidualFunctor
+ * @brief Wraps ResidualFunctor so the solver works with unknowns divided by their characteristic magnitude.
+ * Slip angles, slip ratios and velocities have very different orders of magnitude, solving for the
+ * normalized values keeps every Jacobian column of the same order.
+ */
+
+struct NormalizedResidualFunctor {
+    NormalizedResidualFunctor(const Vehicle& v, const Individual& ind, const ResidualScales& scales) : inner_(v, ind, scales), scales_(scales) {}
+
+    template <typename T>
+    bool operator()(const T* alpha_f, const T* alpha_r, const T* kappa_f, const T* kappa_r,
+                    const T* V, const T* V_x, const T* V_y, T* residuals) const {
+        T a_f = *alpha_f * T(scales_.slipAngle);
+        T a_r = *alpha_r * T(scales_.slipAngle);
+        T k_f = *kappa_f * T(scales_.slipRatio);
+        T k_r = *kappa_r * T(scales_.slipRatio);
+        T v = *V * T(scales_.speed);
+        T v_x = *V_x * T(scales_.speed);
+        T v_y = *V_y * T(scales_.speed);
+        return inner_(&a_f, &a_r, &k_f, &k_r, &v, &v_x, &v_y, residuals);
+    }
+
+private:
+    ResidualFunctor inner_;
+    ResidualScales scales_;
+};
+
+/**
+ * @struct ReducedResidualFunctor
+ * @brief A Ceres cost functor for the reduced 4-unknown formulation of the equilibrium.
+ * The slip angles and the total velocity are substituted explicitly from the velocities with
+ * kinematicSlips(), so only kappa_f, kappa_r, Vx and Vy are unknowns and only the 4 force and
+ * moment balances remain. The unknowns are normalized the same way as in NormalizedResidualFunctor.
+ */
+
+struct ReducedResidualFunctor {
+    ReducedResidualFunctor(const Vehicle& v, const Individual& ind, const ResidualScales& scales) : veh_(v), ind_(ind), scales_(scales) {}
+
+    template <typename T>
+    bool operator()(const T* kappa_f, const T* kappa_r, const T* V_x, const T* V_y, T* residuals) const {
+        T k_f = *kappa_f * T(scales_.slipRatio);
+        T k_r = *kappa_r * T(scales_.slipRatio);
+        T v_x = *V_x * T(scales_.speed);
+        T v_y = *V_y * T(scales_.speed);
+
+        T v, a_f, a_r;
+        kinematicSlips(veh_, ind_.delta, v_x, v_y, v, a_f, a_r);
+        balanceResiduals(veh_, ind_.delta, scales_, a_f, a_r, k_f, k_r, v, v_x, v_y, residuals);
+        return true;
+    }
+
+private:
+    const Vehicle& veh_;
+    const Individual& ind_;
+    ResidualScales scales_;
 };
 
-// Sets the upper and lower bounds for the solver's optimization variables
-void setBoundaries(ceres::Problem& problem, Individual& ind, OptimizationConfig opt);
+/**
+ * @class AbortCallback
+ * @brief A Ceres iteration callback that stops the solve as soon as a condition becomes true.
+ * It is used to cancel solves whose result is no longer needed, for example the remaining
+ * starts of solveMultiStart() once a better one has converged.
+ */
+
+class AbortCallback : public ceres::IterationCallback {
+public:
+    explicit AbortCallback(std::function<bool()> shouldAbort) : shouldAbort_(std::move(shouldAbort)) {}
+
+    ceres::CallbackReturnType operator()(const ceres::IterationSummary&) override {
+        return shouldAbort_() ? ceres::SOLVER_ABORT : ceres::SOLVER_CONTINUE;
+    }
+
+private:
+    std::function<bool()> shouldAbort_;
+};
+
+// Sets the upper and lower bounds for the solver's normalized optimization variables
+void setBoundaries(ceres::Problem& problem, double* x, OptimizationConfig opt, const ResidualScales& scales);
+
+// Ratio between the largest and smallest singular values of the normalized Jacobian of the formulation selected at SolverConfig, at the Individual's solution.
+double jacobianConditionNumber(const Individual& ind, const Vehicle& veh, const SolverConfig& sol);
 
 // Checks if all calculated residuals are within their specified tolerances.
 bool checkResiduals(const Individual& ind, SolverConfig sol);
 
-// Manually verifies convergence by re-calculating residuals with the final solution.
+// Manually verifies convergence by re-calculating the legacy-weighted residuals with the final solution, whatever scales the solver used.
 void verifyConvergence(Individual& ind, Vehicle& veh, SolverConfig sol);
 
-// Solves the system of equations for a single Individual's state.
-void solveIndividual(Individual& ind, Vehicle& veh, SolverConfig sol, OptimizationConfig opt);
+// Solves the system of equations for a single Individual's state, optionally aborting when shouldAbort returns true
+// and copying the full Ceres summary to fullSummary.
+void solveIndividual(Individual& ind, Vehicle& veh, SolverConfig sol, OptimizationConfig opt, const std::function<bool()>& shouldAbort = nullptr,
+                     ceres::Solver::Summary* fullSummary = nullptr);
+
+// Solves the same delta from K diversified initial guesses in parallel, keeping the first start (lowest index) that converges.
+// Every start is abandoned when shouldAbort returns true.
+bool solveMultiStart(Individual& ind, Vehicle& veh, SolverConfig sol, OptimizationConfig opt, int K, const std::function<bool()>& shouldAbort = nullptr);
 
 // Populates the result fields of an Individual after a successful solve.
 void computeIndividualResults(Individual& ind, Vehicle& veh, ceres::Solver::Summary& summary);
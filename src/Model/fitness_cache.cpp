@@ -0,0 +1,103 @@
+#include "src/Model/fitness_cache.h"
+
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+    const size_t shardCount = 64;
+
+    // splitmix64 finalizer, spreads the quantized genes over the whole hash
+    size_t mix(unsigned long long x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<size_t>(x ^ (x >> 31));
+    }
+}
+
+FitnessCache::FitnessCache(double quantumIN) : quantum(quantumIN), shards(shardCount) {}
+
+size_t FitnessCache::KeyHash::operator()(const Key& key) const {
+    size_t h = mix(static_cast<unsigned long long>(key.starts));
+    for (long long gene : key.genes) {
+        h = mix(h ^ static_cast<unsigned long long>(gene));
+    }
+    return h;
+}
+
+FitnessCache::Key FitnessCache::key(const Individual& ind, int starts) const {
+    const double genes[8] = {ind.delta, ind.alpha_F_guess, ind.alpha_R_guess, ind.kappa_F_guess, ind.kappa_R_guess,
+                             ind.V_guess, ind.Vx_guess, ind.Vy_guess};
+    const double limit = 9e18;      // Keeps llround inside the range of long long
+    Key quantized;
+    for (int i = 0; i < 8; i++) {
+        quantized.genes[i] = llround(max(-limit, min(limit, genes[i] / quantum)));
+    }
+    quantized.starts = starts;
+    return quantized;
+}
+
+FitnessCache::Shard& FitnessCache::shardFor(const Key& key) {
+    return shards[KeyHash()(key) % shards.size()];
+}
+
+bool FitnessCache::lookup(const Individual& ind, int starts, Individual& result) {
+    if (!enabled()) return false;
+    return lookup(key(ind, starts), result);
+}
+
+bool FitnessCache::lookup(const Key& key, Individual& result) {
+    if (!enabled()) return false;
+
+    Shard& shard = shardFor(key);
+    lock_guard<mutex> lock(shard.lock);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        missCount++;
+        return false;
+    }
+    hitCount++;
+    result = it->second;
+    return true;
+}
+
+void FitnessCache::store(const Individual& genome, int starts, const Individual& result) {
+    if (!enabled()) return;
+
+    Key genomeKey = key(genome, starts);
+    Shard& shard = shardFor(genomeKey);
+    lock_guard<mutex> lock(shard.lock);
+    shard.entries.emplace(genomeKey, result);
+}
+
+void FitnessCache::clear() {
+    for (Shard& shard : shards) {
+        lock_guard<mutex> lock(shard.lock);
+        shard.entries.clear();
+    }
+    hitCount = 0;
+    missCount = 0;
+}
+
+void FitnessCache::exportEntries(vector<Entry>& out) {
+    out.clear();
+    for (Shard& shard : shards) {
+        lock_guard<mutex> lock(shard.lock);
+        for (const auto& entry : shard.entries) {
+            out.push_back({entry.first.genes, entry.first.starts, entry.second});
+        }
+    }
+}
+
+void FitnessCache::importEntries(const vector<Entry>& in) {
+    if (!enabled()) return;
+
+    for (const Entry& entry : in) {
+        Key key{entry.genes, entry.starts};
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> lock(shard.lock);
+        shard.entries.emplace(key, entry.result);
+    }
+}
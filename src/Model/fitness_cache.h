@@ -0,0 +1,103 @@
+#ifndef FITNESSCACHE_H
+#define FITNESSCACHE_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class FitnessCache
+ * @brief Concurrent memo of solver results indexed by the quantized genome of an Individual.
+ *
+ * The genome is delta plus the seven initial guesses. Every gene is rounded to a multiple of the
+ * quantum, so genomes that only differ by round-off share one entry. The solve is deterministic
+ * for a given genome and number of multi-start guesses, so a stored result can be returned
+ * instead of calling the solver again. The table is split into shards with their own mutex, so
+ * the evaluation threads rarely contend.
+ */
+
+class FitnessCache {
+public:
+    /**
+     * @struct Entry
+     * @brief One stored result with its quantized genome, used to save and restore the cache.
+     */
+    struct Entry {
+        std::array<long long, 8> genes;
+        int starts;
+        Individual result;
+    };
+
+    /**
+     * @struct Key
+     * @brief Quantized genome and number of multi-start guesses, ordered so a batch can be grouped by genome.
+     */
+    struct Key {
+        std::array<long long, 8> genes;
+        int starts;
+        bool operator==(const Key& other) const { return genes == other.genes && starts == other.starts; }
+        bool operator<(const Key& other) const { return genes != other.genes ? genes < other.genes : starts < other.starts; }
+    };
+
+    /**
+     * @brief Creates an empty cache.
+     * @param quantum Rounding step of the genes, 0 or negative disables the cache.
+     */
+    explicit FitnessCache(double quantum = 1e-9);
+
+    bool enabled() const { return quantum > 0.0; }
+
+    /**
+     * @brief Looks for the result of a genome.
+     * @param ind The Individual whose genes are looked up.
+     * @param starts Number of multi-start guesses of the solve.
+     * @param result Receives the stored solved Individual on a hit.
+     * @return true on a hit.
+     */
+    bool lookup(const Individual& ind, int starts, Individual& result);
+
+    //! Same as lookup() with a key made by key().
+    bool lookup(const Key& key, Individual& result);
+
+    //! Stores the solved Individual for its genome.
+    void store(const Individual& genome, int starts, const Individual& result);
+
+    //! Quantized key of a genome, two genomes with the same key share one entry.
+    Key key(const Individual& ind, int starts) const;
+
+    //! Removes every entry and resets the counters.
+    void clear();
+
+    //! Copies every entry, shard by shard (the other shards stay usable meanwhile).
+    void exportEntries(std::vector<Entry>& out);
+
+    //! Adds saved entries, the quantum must be the one they were saved with.
+    void importEntries(const std::vector<Entry>& in);
+
+    size_t hits() const { return hitCount.load(); }
+    size_t misses() const { return missCount.load(); }
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Shard {
+        std::mutex lock;
+        std::unordered_map<Key, Individual, KeyHash> entries;
+    };
+
+    Shard& shardFor(const Key& key);
+
+    double quantum;                         //!< Rounding step of the genes
+    std::vector<Shard> shards;
+    std::atomic<size_t> hitCount{0};
+    std::atomic<size_t> missCount{0};
+};
+
+#endif
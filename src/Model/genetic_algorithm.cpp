@@ -20,60 +20,397 @@ bool compareFitness(const Individual& a, const Individual& b) {
     return a.fitness > b.fitness;
 }
 
+MigrationMailbox::~MigrationMailbox() {
+    collect();
+}
+
+void MigrationMailbox::post(vector<Individual> migrants) {
+    Node* node = new Node{std::move(migrants), head.load(memory_order_relaxed)};
+    while (!head.compare_exchange_weak(node->next, node, memory_order_release, memory_order_relaxed)) {}
+}
+
+vector<Individual> MigrationMailbox::collect() {
+    // Take the whole stack at once, it holds the groups newest first
+    Node* node = head.exchange(nullptr, memory_order_acquire);
+    vector<Node*> nodes;
+    for (; node; node = node->next) {
+        nodes.push_back(node);
+    }
+
+    vector<Individual> migrants;
+    for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) {
+        migrants.insert(migrants.end(), (*it)->migrants.begin(), (*it)->migrants.end());
+        delete *it;
+    }
+    return migrants;
+}
+
 GeneticAlgorithm::GeneticAlgorithm(Vehicle vehicle,OptimizationConfig optIN, SolverConfig solIN) 
-        : population(), popSize(optIN.PopSize), veh(vehicle),opt(optIN),sol(solIN), generations(opt.GenNum), minDelta(opt.minDelta), maxDelta(opt.maxDelta),
-          minAlpha(opt.minAlphaf), maxAlpha(opt.maxAlphaf), minKappa(opt.minKappaf), maxKappa(opt.maxKappar), rd() {
-        random_device randomDevice;
-        rd.seed(randomDevice());
-        progress = 0.0;         //!< Initialize with progress in 0%
-        noSolution = false;     
+        : OptimizerEngine(vehicle, optIN, solIN), population(), popSize(optIN.PopSize), generations(opt.GenNum), minDelta(opt.minDelta), maxDelta(opt.maxDelta),
+          minAlpha(opt.minAlphaf), maxAlpha(opt.maxAlphaf), minKappa(opt.minKappaf), maxKappa(opt.maxKappar), seed(0), cache(optIN.CacheQuantum), stagnation(optIN) {
+        islandsStoppedEarly = 0;
+        solveCount = 0;
+        duplicatesRejected = 0;
+        surrogatePredictions = 0;
+        surrogateScreened = 0;
+        memeticSearches = 0;
+        memeticImproved = 0;
+        memeticSolves = 0;
+        injections = 0;
+        injectedSolved = 0;
+        injectedAccepted = 0;
+        initSamples = 0;
+        initFeasible = 0;
+        migrantsAccepted = 0;
+        replacements = 0;
     }
 
+CounterRng GeneticAlgorithm::stream(uint32_t lineage, uint32_t generation, uint32_t individual, uint32_t id) const {
+    return CounterRng(seed, lineage, generation, individual, id);
+}
+
 void GeneticAlgorithm::updateProgress() {
-        progress += progress_step;
-        int value = static_cast<int>(progress);
-        emit progressChanged(value);
+        // Every accepted Individual is a unit of work, the reporter limits how often the GUI hears about it
+        progress.advance();
+        publishProgress();
     }
 
-void GeneticAlgorithm::evaluateFitness() {
-        sort(population.begin(), population.end(), compareFitness);     //!< Population is ordered by it Fitness
+void GeneticAlgorithm::recordBest(const Individual& ind, uint64_t order) {
+    lock_guard<mutex> lock(traceMutex);
+    // An equal fitness only replaces the best if it was bred first, so parallel solves keep the serial result
+    bool improves = ind.fitness > bestFound.fitness;
+    bool earlierTie = ind.fitness > 0 && ind.fitness == bestFound.fitness && order < bestOrder;
+    if (improves || earlierTie) {
+        bestFound = ind;
+        bestOrder = order;
+    }
+    if (improves) {
+        bestTrace.emplace_back(resumedSeconds + runTimer.nsecsElapsed() * 1e-9, ind.fitness);
+        progress.recordBest(ind.fitness);
+    }
 }
 
-double GeneticAlgorithm:: clamp(double value, double minv, double maxv) {
-        return max(minv, min(maxv, value));     //!< Ensure that the value is between its bounds
+uint64_t GeneticAlgorithm::birthOrder(uint64_t batch, size_t row) {
+    return (batch << 32) | static_cast<uint64_t>(row);
+}
+
+bool GeneticAlgorithm::solveCached(Individual& ind, int starts) {
+    if (cache.lookup(ind, starts, ind)) return true;
+    solveGenome(ind, starts);
+    return false;
+}
+
+void GeneticAlgorithm::solveGenome(Individual& ind, int starts) {
+    // The key is the genome before solving, the multi-start winner may carry other guesses
+    Individual genome = ind;
+    solveMultiStart(ind, veh, sol, opt, starts, [this]() { return stopRequested(); });
+    solveCount++;
+    progress.recordSolve(ind.converged && ind.fitness > 0);
+    if (!stopRequested()) {
+        cache.store(genome, starts, ind);     // An aborted solve says nothing about the genome
     }
+}
 
-double GeneticAlgorithm::randomInRange(double min, double max) {
-        uniform_real_distribution<> dist(min, max);     //!< Generates a random double within a given range using a uniform distribution
-        return dist(rd);
+void GeneticAlgorithm::evaluateBatch(Population& pop, size_t first, size_t count, int starts, BatchPlan& plan, bool rejectDuplicates) {
+    // The batch is planned on the calling thread: rows are grouped by cache key and only the first row of
+    // each group is looked up or solved. The other rows take its result afterwards, in row order, so the
+    // cache hits and the rejected duplicates do not depend on which worker finishes first.
+    uint64_t batch = batches++;
+    plan.source.resize(count);
+    plan.solve.clear();
+    for (size_t i = 0; i < count; i++) plan.source[i] = i;
+    if (cache.enabled()) {
+        plan.keys.resize(count);
+        plan.order.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            plan.keys[i] = cache.key(pop.individual(first + i), starts);
+            plan.order[i] = i;
+        }
+        const FitnessCache::Key* keys = plan.keys.data();
+        sort(plan.order.begin(), plan.order.end(), [keys](size_t a, size_t b) {
+            return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+        });
+        for (size_t k = 1; k < count; k++) {
+            size_t previous = plan.order[k - 1];
+            if (keys[plan.order[k]] == keys[previous]) plan.source[plan.order[k]] = plan.source[previous];
+        }
     }
 
-Individual GeneticAlgorithm:: tournamentSelection(const vector<Individual>& pop, int tournamentSize) {
-    vector<Individual> tournament;
+    // Representatives already in the cache are served here, the others are solved in parallel
+    auto reject = [this](Individual& ind) {
+        ind.fitness = 0.0;
+        ind.converged = false;
+        duplicatesRejected++;
+    };
+    for (size_t i = 0; i < count; i++) {
+        if (plan.source[i] != i) continue;
+        Individual ind;
+        if (cache.enabled() && !stopRequested() && cache.lookup(plan.keys[i], ind)) {
+            // Already explored genome: reject it so a fresh one is bred in its place
+            if (rejectDuplicates) reject(ind);
+            pop.set(first + i, ind);
+            recordBest(ind, birthOrder(batch, i));
+        } else {
+            plan.solve.push_back(i);
+        }
+    }
 
-    // Randomly select individuals for the tournament
-    uniform_int_distribution<> dist(0, pop.size() - 1);
-    for (int i = 0; i < tournamentSize; i++) {
-        int idx = dist(rd);
-        tournament.push_back(pop[idx]);
+    // Every task only touches its own row, veh, sol and opt are read-only.
+    // The full Individual only exists while its row is solved, the best one is kept by recordBest().
+    // Solve costs vary a lot, so idle workers steal the pending rows and multi-start guesses of busy ones.
+    if (!plan.solve.empty()) {
+        TaskGroup group(*scheduler);
+        Population* target = &pop;
+        for (size_t i : plan.solve) {
+            size_t row = first + i;
+            uint64_t order = birthOrder(batch, i);
+            group.run([this, target, row, starts, order]() {
+                if (stopRequested()) {
+                    // Pending rows of a stopped run are left unsolved, keepConverged() drops them
+                    target->fitness()[row] = 0.0;
+                    target->converged()[row] = 0;
+                    return;
+                }
+                Individual ind = target->individual(row);
+                solveGenome(ind, starts);
+                target->set(row, ind);
+                recordBest(ind, order);
+            });
+        }
+        group.wait();
+    }
+
+    // The other rows of every group are cache hits of their representative
+    for (size_t i = 0; i < count; i++) {
+        if (plan.source[i] == i) continue;
+        Individual ind;
+        if (!cache.lookup(plan.keys[i], ind)) {
+            // The solve of the representative was stopped
+            pop.fitness()[first + i] = 0.0;
+            pop.converged()[first + i] = 0;
+            continue;
+        }
+        if (rejectDuplicates) reject(ind);
+        pop.set(first + i, ind);
+    }
+}
+
+size_t GeneticAlgorithm::keepConverged(Population& arena, size_t first, size_t count) {
+    // Stable compaction in place, the rejected ones are overwritten by the next attempt
+    const double* fitness = arena.fitness();
+    size_t end = first;
+    for (size_t i = first; i < first + count; i++) {
+        if (fitness[i] > 0) {
+            if (i != end) arena.copyRow(end, arena, i);
+            end++;
+            updateProgress();
+        }
+    }
+    return end;
+}
+
+void GeneticAlgorithm::evaluateAndLearn(Population& arena, size_t first, size_t count, int starts, bool rejectDuplicates, Workspace& work) {
+    if (!opt.Surrogate) {
+        evaluateBatch(arena, first, count, starts, work.batch, rejectDuplicates);
+        return;
+    }
+
+    // The solve replaces the guesses of a row, so the genomes are taken before it
+    work.surrogate.encode(arena, first, count, work.points);
+    evaluateBatch(arena, first, count, starts, work.batch, rejectDuplicates);
+    if (stopRequested()) return;
+    work.surrogate.add(work.points, arena.fitness() + first, arena.converged() + first);
+    work.surrogate.fit();
+}
+
+void GeneticAlgorithm::screenChildren(const Population& pop, Population& next, size_t first, size_t count, uint32_t lineage, uint32_t generation, uint32_t firstBirth, Workspace& work) {
+    size_t bred = work.parent1.size();
+    work.candidates.resize(bred);
+    crossoverRows(pop, work.candidates, 0, bred, lineage, generation, firstBirth, work);
+
+    work.surrogate.encode(work.candidates, 0, bred, work.points);
+    work.score.resize(bred);
+    work.surrogate.predict(work.points, work.score.data());
+    surrogatePredictions += bred;
+    surrogateScreened += bred - count;
+
+    // Only the most promising candidates are solved, the lowest index wins ties
+    work.shortlist.resize(bred);
+    for (size_t i = 0; i < bred; i++) work.shortlist[i] = i;
+    const double* score = work.score.data();
+    partial_sort(work.shortlist.begin(), work.shortlist.begin() + count, work.shortlist.end(), [score](size_t a, size_t b) {
+        return score[a] > score[b] || (score[a] == score[b] && a < b);
+    });
+    for (size_t i = 0; i < count; i++) {
+        next.copyRow(first + i, work.candidates, work.shortlist[i]);
+    }
+}
+
+Individual GeneticAlgorithm::localSearch(const Individual& elite, uint64_t order) {
+    // The population only reaches delta with mutation steps, a scalar search around the elite
+    // gets the last digits with a few solves. The solver follows the same equilibrium branch
+    // because every solve starts from the last converged solution of the search.
+    double lower = max(minDelta, elite.delta - opt.MemeticRadius);
+    double upper = min(maxDelta, elite.delta + opt.MemeticRadius);
+    Individual best = elite;
+    Individual warm = elite;
+    auto abort = [this]() { return stopRequested(); };
+
+    auto velocityAt = [&](double delta) {
+        if (stopRequested()) return 0.0;
+        Individual ind = warm;
+        ind.delta = delta;
+        ind.fitness = 0.0;
+        ind.converged = false;
+        solveIndividual(ind, veh, sol, opt, abort);
+        solveCount++;
+        memeticSolves++;
+        bool ok = ind.converged && ind.fitness > 0;
+        progress.recordSolve(ok);
+        if (!ok) return 0.0;     // Same zero velocity penalty as the Brent engine
+        warm = ind;
+        recordBest(ind, order);
+        if (ind.fitness > best.fitness) {
+            best = ind;
+        }
+        return ind.fitness;
+    };
+    double deltaBest;
+    brentMaximize(velocityAt, lower, upper, opt.BrentTol, max(opt.MemeticMaxIter, 2), deltaBest);
+    return best;
+}
+
+void GeneticAlgorithm::refineElites(Population& pop, Workspace& work) {
+    size_t elites = min<size_t>(max(opt.MemeticElites, 0), pop.size());
+    if (elites == 0 || stopRequested()) return;
+
+    // Every search is an independent chain of solves, so the elites are refined in parallel
+    pop.argsortByFitness(work.order);
+    uint64_t batch = batches++;
+    TaskGroup group(*scheduler);
+    Population* target = &pop;
+    for (size_t i = 0; i < elites; i++) {
+        size_t row = work.order[i];
+        uint64_t order = birthOrder(batch, i);
+        group.run([this, target, row, order]() {
+            Individual elite = target->individual(row);
+            Individual refined = localSearch(elite, order);
+            if (refined.fitness > elite.fitness) {
+                target->set(row, refined);
+                memeticImproved++;
+            }
+        });
+    }
+    group.wait();
+    memeticSearches += elites;
+}
+
+bool GeneticAlgorithm::memeticDue(int generation) const {
+    return opt.Memetic && opt.MemeticInterval > 0 && generation % opt.MemeticInterval == 0;
+}
+
+const double* GeneticAlgorithm::selectionFitness(const Population& pop, Workspace& work) {
+    pop.argsortByFitness(work.order);
+    if (opt.Niching == NichingMethod::None) return pop.fitness();
+
+    size_t n = pop.size();
+    work.niched.resize(n);
+    nicheFitness(opt.Niching, pop.fitness(), pop.gene(Gene::Delta), work.order.data(), n, opt.NicheRadius, opt.NicheCapacity, work.niched.data());
+
+    // The niche winners come first, so the elites and the mutated rows are spread over the niches.
+    // Cleared rows follow by their own fitness, the index tie-break keeps the order deterministic.
+    const double* niched = work.niched.data();
+    const double* fitness = pop.fitness();
+    sort(work.order.begin(), work.order.end(), [niched, fitness](size_t a, size_t b) {
+        if (niched[a] != niched[b]) return niched[a] > niched[b];
+        if (fitness[a] != fitness[b]) return fitness[a] > fitness[b];
+        return a < b;
+    });
+    return niched;
+}
+
+double GeneticAlgorithm::maintainDiversity(Population& pop, uint32_t lineage, uint32_t generation, Workspace& work) {
+    double entropy = deltaEntropy(pop.gene(Gene::Delta), pop.fitness(), pop.size(), minDelta, maxDelta, opt.EntropyBins, work.histogram);
+    if (opt.MinDeltaEntropy <= 0.0 || entropy >= opt.MinDeltaEntropy || pop.size() < 2 || stopRequested()) {
+        return entropy;
+    }
+
+    // The worst rows are replaced by uniform samples of the whole range, the best one is never touched
+    size_t count = min(pop.size() - 1, max<size_t>(1, static_cast<size_t>(opt.InjectionShare * pop.size())));
+    pop.argsortByFitness(work.order);
+    double velocity = pop.fitness()[work.order[0]];
+    Population& fresh = work.candidates;
+    fresh.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        CounterRng rng = stream(lineage, generation, static_cast<uint32_t>(i), Injection);
+        Individual sample;
+        sample.delta = minDelta + rng.uniform() * (maxDelta - minDelta);
+        sample.alpha_F_guess = minAlpha + rng.uniform() * (maxAlpha - minAlpha);
+        sample.alpha_R_guess = minAlpha + rng.uniform() * (maxAlpha - minAlpha);
+        sample.kappa_F_guess = minKappa + rng.uniform() * (maxKappa - minKappa);
+        sample.kappa_R_guess = minKappa + rng.uniform() * (maxKappa - minKappa);
+        sample.V_guess = velocity;
+        sample.Vx_guess = 0.8 * velocity;
+        sample.Vy_guess = 0.5 * velocity;
+        fresh.set(i, sample);
+    }
+    evaluateAndLearn(fresh, 0, count, opt.MultiStarts, false, work);
+    if (stopRequested()) return entropy;
+
+    // A sample that did not converge leaves its row as it was
+    const double* fitness = fresh.fitness();
+    size_t accepted = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (fitness[i] > 0) {
+            pop.copyRow(work.order[pop.size() - 1 - accepted], fresh, i);
+            accepted++;
+        }
+    }
+    injections++;
+    injectedSolved += count;
+    injectedAccepted += accepted;
+    return entropy;
+}
+
+void GeneticAlgorithm::evaluateFitness(vector<Individual>& pop) {
+        sort(pop.begin(), pop.end(), compareFitness);     //!< Population is ordered by it Fitness
+}
+
+double GeneticAlgorithm:: clamp(double value, double minv, double maxv) {
+        return max(minv, min(maxv, value));     //!< Ensure that the value is between its bounds
+    }
+
+size_t GeneticAlgorithm:: tournamentSelection(const double* score, size_t n, int tournamentSize, CounterRng& rng) {
+    // Randomly select individuals for the tournament, only their rows are kept
+    uint32_t rows = static_cast<uint32_t>(n);
+    size_t winner = rng.index(rows);
+    for (int i = 1; i < tournamentSize; i++) {
+        size_t idx = rng.index(rows);
+        if (score[idx] > score[winner]) {
+            winner = idx;
+        }
     }
     // Return the winner (the one with the highest fitness)
-        return *max_element(tournament.begin(), tournament.end(), compareFitness);
+    return winner;
 }    
     
-void GeneticAlgorithm::crossover(const Individual& parent1, const Individual& parent2, Individual& child) {
-    // Crossover for the gene
-    double alpha_cross = 1.5;
+void GeneticAlgorithm::crossover(const Individual& parent1, const Individual& parent2, Individual& child, uint32_t lineage, uint32_t generation, uint32_t birth, double spreadScale) {
+    // Every gene draws from its own stream, the same ones crossoverRows() uses for a row
+    auto coin = [&](Gene g) { return stream(lineage, generation, birth, CrossoverGenes + static_cast<uint32_t>(g)).uniform() < 0.5; };
+
+    // Blend crossover for the gene, its spread follows the success rule when the operators adapt
+    double alpha_cross = 1.5 * spreadScale;
     double range_delta = abs(parent1.delta - parent2.delta);
     double min_d = min(parent1.delta, parent2.delta) - range_delta * alpha_cross;
     double max_d = max(parent1.delta, parent2.delta) + range_delta * alpha_cross;
-    child.delta = clamp(randomInRange(min_d, max_d), minDelta, maxDelta);
+    double u = stream(lineage, generation, birth, CrossoverGenes + static_cast<uint32_t>(Gene::Delta)).uniform();
+    child.delta = clamp(min_d + u * (max_d - min_d), minDelta, maxDelta);
 
     // Uniform crossover for solver initial guess parameters
-    child.alpha_F_guess = (rand() % 2 == 0) ? parent1.alpha_F_guess : parent2.alpha_F_guess;
-    child.alpha_R_guess = (rand() % 2 == 0) ? parent1.alpha_R_guess : parent2.alpha_R_guess;
-    child.kappa_F_guess = (rand() % 2 == 0) ? parent1.kappa_F_guess : parent2.kappa_F_guess;
-    child.kappa_R_guess = (rand() % 2 == 0) ? parent1.kappa_R_guess : parent2.kappa_R_guess;
+    child.alpha_F_guess = coin(Gene::AlphaF) ? parent1.alpha_F_guess : parent2.alpha_F_guess;
+    child.alpha_R_guess = coin(Gene::AlphaR) ? parent1.alpha_R_guess : parent2.alpha_R_guess;
+    child.kappa_F_guess = coin(Gene::KappaF) ? parent1.kappa_F_guess : parent2.kappa_F_guess;
+    child.kappa_R_guess = coin(Gene::KappaR) ? parent1.kappa_R_guess : parent2.kappa_R_guess;
 
     // Inherit the best guess for velocity
     child.V_guess = max(parent1.V_guess, parent2.V_guess);
@@ -85,148 +422,980 @@ void GeneticAlgorithm::crossover(const Individual& parent1, const Individual& pa
     child.converged = false;
 }
 
-void GeneticAlgorithm::mutate(Individual& ind) {
+void GeneticAlgorithm::mutate(Individual& ind, uint32_t lineage, uint32_t generation, uint32_t birth, double stepScale) {
     double mutation_rate = 0.25;    // 25% chance to mutate each gene
-    // Use normal distributions to create small changes around the current value
-    normal_distribution<> dDelta(0.0, 0.01);
-    normal_distribution<> dAlpha_guess(0.0, 0.05);
-    normal_distribution<> dKappa_guess(0.0, 0.2);
-
-    if (randomInRange(0.0, 1.0) < mutation_rate) {
-        ind.delta = clamp(ind.delta + dDelta(rd), minDelta, maxDelta);
-    }
-    if (randomInRange(0.0, 1.0) < mutation_rate) {
-        ind.alpha_F_guess = clamp(ind.alpha_F_guess + dAlpha_guess(rd), minAlpha, maxAlpha);
-    }
-    if (randomInRange(0.0, 1.0) < mutation_rate) {
-        ind.alpha_R_guess = clamp(ind.alpha_R_guess + dAlpha_guess(rd), minAlpha, maxAlpha);
-    }        
-    if (randomInRange(0.0, 1.0) < mutation_rate) {
-        ind.kappa_F_guess = clamp(ind.kappa_F_guess + dKappa_guess(rd), minKappa, maxKappa);
-    }
-    if (randomInRange(0.0, 1.0) < mutation_rate) {
-        ind.kappa_R_guess = clamp(ind.kappa_R_guess + dKappa_guess(rd), minKappa, maxKappa);
-    }
-
-}
-
-QString GeneticAlgorithm::generateSummary(Individual best, Vehicle veh, OptimizationConfig opt, SolverConfig sol){
-    QString summary;
-    // Handle the case where no solution could be found.
-    if (GeneticAlgorithm::noSolution) {
-        summary = "The solver failed to find solutions for the given turn radius. Please try increasing the maximum number of iterations allowed or changing the vehicle parameters.\n\n";
-        return summary;
-    }
-
-    // Builds the detailed summary for Results tab in GUI
-    summary += "======================\n";
-    summary += "FINAL OPTIMIZED RESULT\n";
-    summary += "======================\n";
-    summary += QString("Max Velocity: %1 m/s\n").arg(best.fitness);
-    summary += QString("Max Vx: %1 m/s\n").arg(best.Vx);
-    summary += QString("Max Vy: %1 m/s\n").arg(best.Vy);
-    summary += QString("Yaw Velocity: %1 degrees\n").arg(radToDegree(best.r));
-    summary += QString("Max acc: %1 m/s^2\n\n").arg(best.ay);
-    summary += QString("Optimized Delta: %1 degrees\n").arg(radToDegree(best.delta));
-    summary += QString("Optimized Front Lateral Tire Force: %1 N\n").arg(best.MF_Fy_F);
-    summary += QString("Optimized Rear Lateral Tire Force: %1 N\n").arg(best.MF_Fy_R);
-    summary += QString("Optimized Front Longitudinal Tire Force: %1 N\n").arg(best.MF_Fx_F);
-    summary += QString("Optimized Rear Longitudinal Tire Force: %1 N\n\n").arg(best.MF_Fx_R);
-    summary += QString("Load Distribution on the front tire: %1 N\n").arg(best.Fz_F);
-    summary += QString("Load Distribution on the rear tire: %1 N\n\n").arg(best.Fz_R);
-    summary += QString("Front Slip Angle: %1 degree\n").arg(radToDegree(best.alpha_F));
-    summary += QString("Rear Slip Angle: %1 degree\n").arg(radToDegree(best.alpha_R));
-    summary += QString("Front Slip Ratio: %1 [-]\n").arg(best.kappa_F);
-    summary += QString("Rear Slip Ratio: %1 [-]\n\n").arg(best.kappa_R);
-    summary += "========================\n\n";
-
-    summary += "Car Parameters:\n";
-    summary += "===============\n";
-    summary += QString("Turn Radius: %1 m\n").arg(veh.R);
-    summary += QString("CG to Front Axle: %1 m\n").arg(veh.a);
-    summary += QString("CG to Rear Axle: %1 m\n").arg(veh.b);
-    summary += QString("Vehicle Mass: %1 kg\n").arg(veh.m);
-    summary += "===============\n\n";
-
-    summary += "Solver Parameters:\n";
-    summary += "==================\n";
-    summary += QString("Max Iterations: %1\n").arg(sol.maxIter);
-    summary += "==================\n\n";
-
-    summary += "Optimization Parameters:\n";
-    summary += "========================\n";
-    summary += QString("Generations: %1\n").arg(opt.GenNum);
-    summary += QString("Population Size: %1\n").arg(opt.PopSize);
-    summary += QString("Delta Range: [%1 , %2] degrees\n\n").arg(radToDegree(opt.minDelta)).arg(radToDegree(opt.maxDelta));
-    summary += QString("Alpha_f Range: [%1 , %2] degrees\n").arg(radToDegree(opt.minAlphaf)).arg(radToDegree(opt.maxAlphar));
-    summary += QString("Alpha_r Range: [%1 , %2] degrees\n").arg(radToDegree(opt.minAlphar)).arg(radToDegree(opt.maxAlphar));
-    summary += QString("Kappa_f Range: [%1 , %2] [-]\n").arg(opt.minKappaf).arg(opt.maxKappar);
-    summary += QString("Kappa_r Range: [%1 , %2] [-]\n").arg(opt.minKappar).arg(opt.maxKappar);
-    summary += "========================\n\n";
-
-    summary += "\nSOLVER QUALITY\n";
-    summary += "===============\n";
-    summary += QString("Number of Iterations: %1\n").arg(best.summary.iterations.size());
-    summary += QString("Final Cost: %1\n\n").arg(best.summary.final_cost);
-    summary += "Residuals:\n";
-    for (int i = 0; i < 7; i++) {
-        summary += QString("r[%1] = %2\n").arg(i).arg(best.residuals[i]);
-    }
-    summary += "===============\n\n\n";
-
-    return summary;
+    // Adaptive steps are stretched like the ones of mutateRows()
+    const OptimizationConfig defaults;
+    auto stretch = [&](double lower, double upper, double defaultLower, double defaultUpper) {
+        return opt.AdaptiveOperators ? stepScale * (upper - lower) / (defaultUpper - defaultLower) : 1.0;
+    };
+    double deltaStep = stretch(minDelta, maxDelta, defaults.minDelta, defaults.maxDelta);
+    double alphaStep = stretch(minAlpha, maxAlpha, defaults.minAlphaf, defaults.maxAlphaf);
+    double kappaStep = stretch(minKappa, maxKappa, defaults.minKappaf, defaults.maxKappar);
+
+    // Use normal distributions to create small changes around the current value.
+    // Every gene draws from its own stream, the same ones mutateRows() uses for a row.
+    auto mutateGene = [&](double& x, Gene g, double sigma, double lower, double upper) {
+        CounterRng rng = stream(lineage, generation, birth, static_cast<uint32_t>(g));
+        double u = rng.uniform();
+        double z = rng.normal();
+        if (u < mutation_rate) {
+            x = clamp(x + sigma * z, lower, upper);
+        }
+    };
+
+    mutateGene(ind.delta, Gene::Delta, 0.01 * deltaStep, minDelta, maxDelta);
+    mutateGene(ind.alpha_F_guess, Gene::AlphaF, 0.05 * alphaStep, minAlpha, maxAlpha);
+    mutateGene(ind.alpha_R_guess, Gene::AlphaR, 0.05 * alphaStep, minAlpha, maxAlpha);
+    mutateGene(ind.kappa_F_guess, Gene::KappaF, 0.2 * kappaStep, minKappa, maxKappa);
+    mutateGene(ind.kappa_R_guess, Gene::KappaR, 0.2 * kappaStep, minKappa, maxKappa);
+
 }
 
-void GeneticAlgorithm::run() {
-    // --- 1. INITIALIZATION ---
-    progress = 0.0;
-    progress_step = 100.0 / ((generations + 1) * popSize);      // Progress step is calculate with the number of individual needed to create the population
+void GeneticAlgorithm::crossoverRows(const Population& parents, Population& children, size_t first, size_t count, uint32_t lineage, uint32_t generation, uint32_t firstBirth, Workspace& work) {
+    // Same operator as crossover(), applied as one pass per gene array.
+    // The random numbers are drawn first, so the arithmetic loops are branch-free and vectorizable.
+    const size_t* p1 = work.parent1.data();
+    const size_t* p2 = work.parent2.data();
+    work.uniform.resize(count);
+    double* u = work.uniform.data();
+    auto draw = [&](Gene g) {
+        for (size_t i = 0; i < count; i++) {
+            u[i] = stream(lineage, generation, firstBirth + static_cast<uint32_t>(i), CrossoverGenes + static_cast<uint32_t>(g)).uniform();
+        }
+    };
+
+    // Blend crossover for the gene, its spread follows the success rule when the operators adapt
+    double alpha_cross = 1.5 * work.adaptation.spreadScale();
+    draw(Gene::Delta);
+    const double* d = parents.gene(Gene::Delta);
+    double* childDelta = children.gene(Gene::Delta) + first;
+    for (size_t i = 0; i < count; i++) {
+        double d1 = d[p1[i]], d2 = d[p2[i]];
+        double range_delta = abs(d1 - d2);
+        double min_d = min(d1, d2) - range_delta * alpha_cross;
+        double max_d = max(d1, d2) + range_delta * alpha_cross;
+        childDelta[i] = max(minDelta, min(maxDelta, min_d + u[i] * (max_d - min_d)));
+    }
+
+    // Uniform crossover for solver initial guess parameters
+    for (Gene g : {Gene::AlphaF, Gene::AlphaR, Gene::KappaF, Gene::KappaR}) {
+        draw(g);
+        const double* src = parents.gene(g);
+        double* dst = children.gene(g) + first;
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = (u[i] < 0.5) ? src[p1[i]] : src[p2[i]];
+        }
+    }
+
+    // Inherit the best guess for velocity
+    const double* v = parents.gene(Gene::V);
+    double* V = children.gene(Gene::V) + first;
+    double* Vx = children.gene(Gene::Vx) + first;
+    double* Vy = children.gene(Gene::Vy) + first;
+    for (size_t i = 0; i < count; i++) {
+        V[i] = max(v[p1[i]], v[p2[i]]);
+        Vx[i] = 0.8 * V[i];
+        Vy[i] = 0.5 * V[i];
+    }
+
+    // Ensure that there is no garbage value fo child fitness
+    fill_n(children.fitness() + first, count, 0.0);
+    fill_n(children.converged() + first, count, 0);
+}
+
+void GeneticAlgorithm::mutateRows(Population& pop, size_t first, size_t count, uint32_t lineage, uint32_t generation, uint32_t firstBirth, Workspace& work) {
+    // Same operator as mutate(), applied as one pass per gene array.
+    // Adaptive steps are the fixed sigmas stretched from the default bounds to the configured ones, times the success rule scale.
+    const OptimizationConfig defaults;
+    double scale = work.adaptation.stepScale();
+    auto stretch = [&](double lower, double upper, double defaultLower, double defaultUpper) {
+        return opt.AdaptiveOperators ? scale * (upper - lower) / (defaultUpper - defaultLower) : 1.0;
+    };
+    double deltaStep = stretch(minDelta, maxDelta, defaults.minDelta, defaults.maxDelta);
+    double alphaStep = stretch(minAlpha, maxAlpha, defaults.minAlphaf, defaults.maxAlphaf);
+    double kappaStep = stretch(minKappa, maxKappa, defaults.minKappaf, defaults.maxKappar);
+
+    struct GeneMutation { Gene gene; double sigma, lower, upper; };
+    const GeneMutation mutations[] = {
+        {Gene::Delta, 0.01 * deltaStep, minDelta, maxDelta},
+        {Gene::AlphaF, 0.05 * alphaStep, minAlpha, maxAlpha},
+        {Gene::AlphaR, 0.05 * alphaStep, minAlpha, maxAlpha},
+        {Gene::KappaF, 0.2 * kappaStep, minKappa, maxKappa},
+        {Gene::KappaR, 0.2 * kappaStep, minKappa, maxKappa},
+    };
+    double mutation_rate = 0.25;    // 25% chance to mutate each gene
+
+    work.uniform.resize(count);
+    work.normal.resize(count);
+    const double* u = work.uniform.data();
+    const double* z = work.normal.data();
+
+    for (const GeneMutation& m : mutations) {
+        for (size_t i = 0; i < count; i++) {
+            CounterRng rng = stream(lineage, generation, firstBirth + static_cast<uint32_t>(i), static_cast<uint32_t>(m.gene));
+            work.uniform[i] = rng.uniform();
+            work.normal[i] = rng.normal();
+        }
+        double* x = pop.gene(m.gene) + first;
+        for (size_t i = 0; i < count; i++) {
+            double step = (u[i] < mutation_rate) ? m.sigma * z[i] : 0.0;
+            x[i] = max(m.lower, min(m.upper, x[i] + step));
+        }
+    }
+}
+
+bool GeneticAlgorithm::initializePopulation(Population& pop, size_t size, uint32_t lineage) {
+    // Create the first generation of valid individuals.
+    // Candidates cover (delta, guesses) with the configured design and are solved in parallel batches. The batches
+    // are sized from the feasible fraction seen so far, and the whole initialization is bounded by a budget of solves.
+    const int dims = 7;         // delta, alpha_f, alpha_r, kappa_f, kappa_r, Vx, Vy
     double Max_V_guess = 30.0;
-    population.clear(); 
+    size_t budget = opt.InitBudget > 0 ? opt.InitBudget : 20 * size;
+    size_t fastFail = min<size_t>(max(opt.FastFailSamples, 1), budget);
+    size_t evaluated = 0, feasible = 0;
 
-    // --- 2. GENERATE INITIAL POPULATION ---
-    // Create the first generation of random, valid individuals.
-    for (size_t i = 0; i < popSize; ++i) {
-        size_t count = 0;
-        bool converge = false;
-        while (!converge) {
-            // Loop until a converged solution is found.
-            if (count > 1000) {
-                // Escape hatch if the solver gets stuck.
-                //std::cout << "\n\nThe solver failed to find solutions for a " << veh.R << " meters turn Radius\n\n";
-                noSolution = true;
-                break;
+    // The initial population is generation 0, a sample is identified by its index in the design
+    CounterRng shiftRng = stream(lineage, 0, 0, SamplingShift);
+    SobolSequence sobol(dims, shiftRng);
+    vector<double> samples;
+    Population batch;
+    BatchPlan plan;
+    pop.clear();
+
+    // Re-converged Individuals of the previous run come first, dealt to the islands in turn
+    for (size_t i = 0; i < seeds.size() && pop.size() < size; i++) {
+        if (lineage == 0 || i % seedLanes == lineage - 1) {
+            pop.push_back(seeds[i]);
+            updateProgress();
+        }
+    }
+
+    while (pop.size() < size && evaluated < budget && !stopRequested()) {
+        size_t needed = size - pop.size();
+        size_t count = needed;
+        if (feasible == 0) {
+            count = max(needed, fastFail);
+        } else {
+            count = static_cast<size_t>(ceil(needed * static_cast<double>(evaluated) / feasible));
+        }
+        count = min(count, budget - evaluated);
+
+        // Points of the design in the unit hypercube
+        samples.resize(count * dims);
+        switch (opt.Sampling) {
+        case InitSampling::Sobol:
+            for (size_t i = 0; i < count; i++) sobol.next(&samples[i * dims]);
+            break;
+        case InitSampling::LatinHypercube: {
+            CounterRng rng = stream(lineage, 0, static_cast<uint32_t>(evaluated), SamplingDesign);
+            latinHypercube(count, dims, rng, samples.data());
+            break;
+        }
+        case InitSampling::Random:
+        default:
+            for (size_t i = 0; i < count; i++) {
+                CounterRng rng = stream(lineage, 0, static_cast<uint32_t>(evaluated + i), SamplingDesign);
+                for (int d = 0; d < dims; d++) samples[i * dims + d] = rng.uniform();
             }
-            // Create a random individual.
+            break;
+        }
+
+        // Scale them to the gene ranges
+        batch.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            const double* u = &samples[i * dims];
             Individual initial;
-            initial.delta = randomInRange(minDelta, maxDelta);
-            initial.alpha_F_guess = randomInRange(minAlpha, maxAlpha);
-            initial.alpha_R_guess = randomInRange(minAlpha, maxAlpha);
-            initial.kappa_F_guess = randomInRange(minKappa, maxKappa);
-            initial.kappa_R_guess = randomInRange(minKappa, maxKappa);
+            initial.delta = minDelta + u[0] * (maxDelta - minDelta);
+            initial.alpha_F_guess = minAlpha + u[1] * (maxAlpha - minAlpha);
+            initial.alpha_R_guess = minAlpha + u[2] * (maxAlpha - minAlpha);
+            initial.kappa_F_guess = minKappa + u[3] * (maxKappa - minKappa);
+            initial.kappa_R_guess = minKappa + u[4] * (maxKappa - minKappa);
             initial.V_guess = Max_V_guess;
-            initial.Vx_guess = randomInRange(0.0, initial.V_guess);
-            initial.Vy_guess = randomInRange(0.0, 0.1 * initial.V_guess);
-
-            // Solve for this individual's fitness.
-            solveIndividual(initial, veh, sol, opt);
-            if (initial.fitness != 0) {
-                if (Max_V_guess < initial.fitness) {
-                    Max_V_guess = initial.fitness;
+            initial.Vx_guess = u[5] * initial.V_guess;
+            initial.Vy_guess = u[6] * 0.1 * initial.V_guess;
+            batch.set(i, initial);
+        }
+
+        // Solve for their fitness, each one from several guesses at once.
+        evaluateBatch(batch, 0, count, opt.MultiStarts, plan);
+        evaluated += count;
+
+        // Keep the converged ones in batch order.
+        const double* fitness = batch.fitness();
+        for (size_t i = 0; i < count; i++) {
+            if (fitness[i] != 0) {
+                feasible++;
+                if (Max_V_guess < fitness[i]) {
+                    Max_V_guess = fitness[i];
+                }
+                if (pop.size() < size) {
+                    size_t row = pop.size();
+                    pop.resize(row + 1);
+                    pop.copyRow(row, batch, i);
+                    updateProgress(); // emits progressChanged (queued to GUI thread)
+                }
+            }
+        }
+
+        // Fast fail: none of the first samples converged, the configuration is hopeless
+        if (feasible == 0 && evaluated >= fastFail) {
+            break;
+        }
+    }
+
+    initSamples += evaluated;
+    initFeasible += feasible;
+
+    // A partial population still evolves, the first generation fills it with children
+    return pop.size() >= min<size_t>(2, size);
+}
+
+QString GeneticAlgorithm::initializationReport() const {
+    const char* design = (opt.Sampling == InitSampling::Sobol) ? "Sobol"
+                       : (opt.Sampling == InitSampling::LatinHypercube) ? "Latin hypercube" : "Random";
+    size_t samples = initSamples.load();
+    double fraction = samples > 0 ? 100.0 * initFeasible.load() / samples : 0.0;
+    QString report;
+    report += QString("Random Seed: %1\n").arg(static_cast<qulonglong>(seed));
+    report += QString("Initial Sampling: %1, %2 solver calls\n").arg(design).arg(samples);
+    report += QString("Feasible Fraction: %1 % (%2 converged)\n").arg(fraction, 0, 'f', 1).arg(initFeasible.load());
+    return report;
+}
+
+bool GeneticAlgorithm::evolveGeneration(Population& pop, Population& next, size_t size, uint32_t lineage, uint32_t generation, Workspace& work) {
+    // Rank the current population, only the fitness and delta arrays are touched.
+    // With niching the ranking and the tournaments use the fitness inside each delta niche.
+    const double* score = selectionFitness(pop, work);
+    const size_t* ranked = work.order.data();
+
+    // The next generation is built in place in the second arena. Both arenas and the workspace
+    // keep their capacity between generations, so after the first one the bookkeeping does not
+    // allocate. Rows sent to the solver still do: every solve task is a heap-allocated std::function
+    // (its capture exceeds the small buffer) in a scheduler deque, besides the solver's own allocations.
+    next.resize(size);
+    size_t filled = 0;
+    uint32_t birth = 0;     // Random stream coordinate of every bred row, also counts the rejected ones
+
+    // Elitism: Preserve the best individuals.
+    // At least one elite and one clone are kept, so small islands do not lose their best solution.
+    size_t elite_count = min(max<size_t>(1, size / 20), pop.size());
+    for (size_t i = 0; i < elite_count; i++) {
+        next.copyRow(filled++, pop, ranked[i]);
+        updateProgress();
+    }
+
+    // Mutate some of the best individuals to explore nearby solutions.
+    size_t mutation_count = min(max<size_t>(1, size / 20), size - filled);
+    size_t parents = min<size_t>(5, pop.size());
+    work.parentFitness.resize(mutation_count);
+    for (size_t i = 0; i < mutation_count; i++) {
+        next.copyRow(filled + i, pop, ranked[i % parents]);
+        work.parentFitness[i] = pop.fitness()[ranked[i % parents]];
+    }
+    mutateRows(next, filled, mutation_count, lineage, generation, birth, work);
+    birth += static_cast<uint32_t>(mutation_count);
+    evaluateAndLearn(next, filled, mutation_count, 1, opt.RejectDuplicates, work);
+    work.adaptation.recordMutations(mutation_count, countImproved(next, filled, mutation_count, work));
+    filled = keepConverged(next, filled, mutation_count);
+
+    // Crossover: Fill the rest of the population with children.
+    // All the children missing are bred in place first, then solved together.
+    // Duplicates are only rejected for a few rounds, a converged population may not have anything new to offer.
+    int round = 0;
+    while (filled < size) {
+        // A stopped run keeps the last complete generation
+        if (stopRequested()) return false;
+
+        bool rejectDuplicates = opt.RejectDuplicates && round++ < 3;
+        size_t count = size - filled;
+        // With a trained surrogate more candidates are bred than solved
+        bool screen = opt.Surrogate && work.surrogate.ready();
+        size_t bred = screen ? count * max(opt.SurrogateOversample, 1) : count;
+        work.parent1.resize(bred);
+        work.parent2.resize(bred);
+        for (size_t i = 0; i < bred; i++) {
+            uint32_t child = birth + static_cast<uint32_t>(i);
+            CounterRng first = stream(lineage, generation, child, FirstParent);
+            CounterRng second = stream(lineage, generation, child, SecondParent);
+            work.parent1[i] = tournamentSelection(score, pop.size(), 3, first);
+            work.parent2[i] = tournamentSelection(score, pop.size(), 3, second);
+        }
+        if (screen) {
+            screenChildren(pop, next, filled, count, lineage, generation, birth, work);
+        } else {
+            crossoverRows(pop, next, filled, count, lineage, generation, birth, work);
+        }
+        // A child succeeds if it beats its better parent, the screened children keep the parents of their candidate
+        work.parentFitness.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            size_t k = screen ? work.shortlist[i] : i;
+            work.parentFitness[i] = max(pop.fitness()[work.parent1[k]], pop.fitness()[work.parent2[k]]);
+        }
+        birth += static_cast<uint32_t>(bred);
+        evaluateAndLearn(next, filled, count, opt.MultiStarts, rejectDuplicates, work);
+        work.adaptation.recordCrossovers(count, countImproved(next, filled, count, work));
+        filled = keepConverged(next, filled, count);
+    }
+
+    // The operators of the next generation follow the success rates of this one
+    work.adaptation.endGeneration(generation);
+    pop.swap(next);
+    return true;
+}
+
+size_t GeneticAlgorithm::countImproved(const Population& arena, size_t first, size_t count, const Workspace& work) const {
+    const double* fitness = arena.fitness() + first;
+    const double* target = work.parentFitness.data();
+    size_t improved = 0;
+    for (size_t i = 0; i < count; i++) {
+        improved += fitness[i] > target[i] ? 1 : 0;
+    }
+    return improved;
+}
+
+void GeneticAlgorithm::migrate(vector<unique_ptr<Island>>& islands, size_t from, uint32_t generation) {
+    Island& source = *islands[from];
+    size_t count = min<size_t>(max(opt.MigrationCount, 0), source.population.size());
+    if (count == 0 || islands.size() < 2) return;
+
+    source.population.argsortByFitness(source.work.order);
+    vector<Individual> elites;
+    for (size_t i = 0; i < count; i++) {
+        elites.push_back(source.population.individual(source.work.order[i]));
+    }
+    size_t n = islands.size();
+
+    switch (opt.Topology) {
+    case MigrationTopology::FullyConnected:
+        for (size_t to = 0; to < n; to++) {
+            if (to != from) islands[to]->inbox.post(elites);
+        }
+        break;
+    case MigrationTopology::Random: {
+        CounterRng rng = stream(source.lineage, generation, 0, Migration);
+        islands[(from + 1 + rng.index(static_cast<uint32_t>(n - 1))) % n]->inbox.post(elites);
+        break;
+    }
+    case MigrationTopology::Ring:
+    default:
+        islands[(from + 1) % n]->inbox.post(elites);
+        break;
+    }
+}
+
+void GeneticAlgorithm::receiveMigrants(Island& island) {
+    vector<Individual> migrants = island.inbox.collect();
+    if (migrants.empty() || island.population.empty()) return;
+
+    // A migrant replaces the current worst Individual only if it is better
+    island.population.argsortByFitness(island.work.order);
+    evaluateFitness(migrants);
+    const double* fitness = island.population.fitness();
+    size_t worst = island.population.size();
+    for (const Individual& migrant : migrants) {
+        if (worst == 0 || migrant.fitness <= fitness[island.work.order[worst - 1]]) break;
+        island.population.set(island.work.order[--worst], migrant);
+        migrantsAccepted++;
+    }
+}
+
+bool GeneticAlgorithm::runIslands() {
+    size_t islandCount = min<size_t>(opt.Islands, max<size_t>(popSize / 2, 1));
+    vector<unique_ptr<Island>> islands;
+    for (size_t i = 0; i < islandCount; i++) {
+        auto island = make_unique<Island>();
+        island->size = popSize / islandCount + (i < popSize % islandCount ? 1 : 0);
+        island->lineage = static_cast<uint32_t>(i + 1);
+        island->work.surrogate.reset(opt);
+        island->work.adaptation = OperatorAdaptation(opt);
+        island->population.reserve(island->size);
+        island->next.reserve(island->size);
+        islands.push_back(std::move(island));
+    }
+
+    islandEntropyTrace.assign(islandCount, vector<double>());    // Every island only appends to its own trace
+
+    // Every island is one long task that creates nested evaluation tasks.
+    // Islands only meet through their mailboxes, so there is no barrier between generations.
+    atomic<size_t> failedIslands(0);
+    TaskGroup group(*scheduler);
+    for (size_t i = 0; i < islandCount; i++) {
+        group.run([this, &islands, &failedIslands, i]() {
+            Island& island = *islands[i];
+            if (!initializePopulation(island.population, island.size, island.lineage)) {
+                island.population.clear();
+                failedIslands++;
+                return;
+            }
+            int interval = max(opt.MigrationInterval, 1);
+            StagnationMonitor monitor(opt);
+            monitor.update(0, island.population.fitness(), island.population.gene(Gene::Delta), island.population.size());
+            vector<double>& entropy = islandEntropyTrace[i];
+            entropy.push_back(deltaEntropy(island.population.gene(Gene::Delta), island.population.fitness(), island.population.size(),
+                                           minDelta, maxDelta, opt.EntropyBins, island.work.histogram));
+            for (int gen = 0; gen < generations && !stopRequested(); gen++) {
+                receiveMigrants(island);
+                evolveGeneration(island.population, island.next, island.size, island.lineage, gen + 1, island.work);
+                if (memeticDue(gen + 1)) {
+                    refineElites(island.population, island.work);
+                }
+                entropy.push_back(maintainDiversity(island.population, island.lineage, gen + 1, island.work));
+                if (opt.AdaptiveOperators) {
+                    AdaptationStep step = island.work.adaptation.lastStep();
+                    step.island = static_cast<int>(island.lineage);
+                    lock_guard<mutex> lock(traceMutex);
+                    adaptationTrace.push_back(step);
+                }
+                if (monitor.update(gen + 1, island.population.fitness(), island.population.gene(Gene::Delta), island.population.size())) {
+                    // The last elites still reach the neighbours before the island stops
+                    migrate(islands, i, gen + 1);
+                    islandsStoppedEarly++;
+                    break;
+                }
+                if ((gen + 1) % interval == 0) {
+                    migrate(islands, i, gen + 1);
+                }
+            }
+        });
+    }
+    group.wait();
+
+    if (failedIslands == islandCount) return false;
+
+    // Merge the final islands
+    population.clear();
+    for (auto& island : islands) {
+        receiveMigrants(*island);
+        for (size_t row = 0; row < island->population.size(); row++) {
+            population.push_back(island->population.individual(row));
+        }
+    }
+    return true;
+}
+
+Individual GeneticAlgorithm::slotTournament(vector<Slot>& places, int tournamentSize, CounterRng& rng) {
+    uint32_t n = static_cast<uint32_t>(places.size());
+    Individual winner;
+    for (int i = 0; i < tournamentSize; i++) {
+        Slot& slot = places[rng.index(n)];
+        lock_guard<mutex> lock(slot.lock);
+        if (i == 0 || slot.ind.fitness > winner.fitness) {
+            winner = slot.ind;
+        }
+    }
+    return winner;
+}
+
+bool GeneticAlgorithm::replaceLoser(vector<Slot>& places, const Individual& child, int tournamentSize, CounterRng& rng) {
+    // Inverse tournament: the worst of a few random places is the candidate for replacement
+    uint32_t n = static_cast<uint32_t>(places.size());
+    size_t loser = rng.index(n);
+    double loserFitness;
+    {
+        lock_guard<mutex> lock(places[loser].lock);
+        loserFitness = places[loser].ind.fitness;
+    }
+    for (int i = 1; i < tournamentSize; i++) {
+        size_t idx = rng.index(n);
+        lock_guard<mutex> lock(places[idx].lock);
+        if (places[idx].ind.fitness < loserFitness) {
+            loser = idx;
+            loserFitness = places[idx].ind.fitness;
+        }
+    }
+
+    // Another worker may have replaced the loser meanwhile, compare again under its lock
+    lock_guard<mutex> lock(places[loser].lock);
+    if (child.fitness <= places[loser].ind.fitness) return false;
+    places[loser].ind = child;
+    return true;
+}
+
+bool GeneticAlgorithm::runSteadyState() {
+    if (!initializePopulation(population, popSize, 0)) return false;
+
+    vector<Slot> places(population.size());
+    for (size_t i = 0; i < population.size(); i++) {
+        places[i].ind = population.individual(i);
+    }
+
+    // Same number of children as the generational GA, but nobody waits for the slowest solve of a generation
+    size_t budget = static_cast<size_t>(max(generations, 0)) * popSize;
+    double mutationRate = 1.0 / 20.0;       // Same share of mutated clones as the generational GA
+    atomic<size_t> started(0);
+    atomic<size_t> completed(0);
+    atomic<bool> stop(false);
+    mutex monitorMutex;
+    stagnation.update(0, population.fitness(), population.gene(Gene::Delta), population.size());
+
+    // Every popSize children count as one generation for the stagnation criteria and the operator adaptation
+    auto checkStagnation = [this, &places, &monitorMutex, &stop](size_t done) {
+        lock_guard<mutex> monitorLock(monitorMutex);
+        AdaptationStep step = workspace.adaptation.endGeneration(static_cast<int>(done / popSize));
+        if (opt.AdaptiveOperators) {
+            adaptationTrace.push_back(step);
+        }
+        vector<double> fitness(places.size()), delta(places.size());
+        for (size_t i = 0; i < places.size(); i++) {
+            lock_guard<mutex> lock(places[i].lock);
+            fitness[i] = places[i].ind.fitness;
+            delta[i] = places[i].ind.delta;
+        }
+        int generation = static_cast<int>(done / popSize);
+        if (stagnation.update(generation, fitness.data(), delta.data(), places.size())) {
+            stop = true;
+        } else {
+            progress.setStep(100.0 / ((stagnation.estimatedEnd(generations) + 1) * popSize));
+        }
+    };
+
+    int workers = scheduler->workerCount();
+    uint64_t batch = batches++;     // The children are ordered by k for the ties of recordBest()
+    TaskGroup group(*scheduler);
+    for (int w = 0; w < workers; w++) {
+        group.run([this, &places, &started, &completed, &stop, &monitorMutex, &checkStagnation, budget, mutationRate, batch]() {
+            size_t k;
+            while (!stop && !stopRequested() && (k = started++) < budget) {
+                // The k-th child draws its decisions from its own streams, whichever worker breeds it
+                uint32_t generation = static_cast<uint32_t>(1 + k / popSize);
+                uint32_t birth = static_cast<uint32_t>(k % popSize);
+                double stepScale, spreadScale;
+                {
+                    lock_guard<mutex> monitorLock(monitorMutex);
+                    stepScale = workspace.adaptation.stepScale();
+                    spreadScale = workspace.adaptation.spreadScale();
+                }
+                Individual child;
+                int starts = opt.MultiStarts;
+                bool mutated = stream(0, generation, birth, OperatorChoice).uniform() < mutationRate;
+                double parentFitness;
+                if (mutated) {
+                    CounterRng first = stream(0, generation, birth, FirstParent);
+                    child = slotTournament(places, 3, first);
+                    parentFitness = child.fitness;
+                    mutate(child, 0, generation, birth, stepScale);
+                    starts = 1;
+                } else {
+                    CounterRng first = stream(0, generation, birth, FirstParent);
+                    CounterRng second = stream(0, generation, birth, SecondParent);
+                    Individual parent1 = slotTournament(places, 3, first);
+                    Individual parent2 = slotTournament(places, 3, second);
+                    parentFitness = max(parent1.fitness, parent2.fitness);
+                    crossover(parent1, parent2, child, 0, generation, birth, spreadScale);
                 }
-                population.push_back(initial);
-                converge = true;
-                updateProgress(); // emits progressChanged (queued to GUI thread)
-            } else {
-                count++;
+
+                bool duplicate = solveCached(child, starts);
+                recordBest(child, birthOrder(batch, k));
+                {
+                    // Same success criteria as countImproved(): fitter than the (best) parent
+                    lock_guard<mutex> monitorLock(monitorMutex);
+                    size_t improved = child.fitness > parentFitness ? 1 : 0;
+                    if (mutated) {
+                        workspace.adaptation.recordMutations(1, improved);
+                    } else {
+                        workspace.adaptation.recordCrossovers(1, improved);
+                    }
+                }
+                if (duplicate && opt.RejectDuplicates) {
+                    duplicatesRejected++;
+                } else if (child.fitness > 0) {
+                    CounterRng rng = stream(0, generation, birth, Replacement);
+                    if (replaceLoser(places, child, 3, rng)) {
+                        replacements++;
+                    }
+                }
+                updateProgress();
+
+                size_t done = ++completed;
+                if (done % popSize == 0) {
+                    checkStagnation(done);
+                }
+            }
+        });
+    }
+    group.wait();
+
+    for (size_t i = 0; i < places.size(); i++) {
+        population.set(i, places[i].ind);
+    }
+    return true;
+}
+
+void GeneticAlgorithm::setRunMemory(shared_ptr<RunMemory> runMemory) {
+    memory = std::move(runMemory);
+}
+
+void GeneticAlgorithm::prepareWarmStart() {
+    seeds.clear();
+    warmOffered = 0;
+    warmCacheEntries = 0;
+    seedLanes = (opt.Islands > 1 && !opt.SteadyState) ? min<size_t>(opt.Islands, max<size_t>(popSize / 2, 1)) : 1;
+    if (!memory || opt.ColdStart) return;
+    shared_ptr<const RunMemory::Snapshot> last = memory->recall();
+    if (!last || last->population.empty()) return;
+
+    // Same solver problem (e.g. only GA settings changed): the stored results are still exact
+    if (cache.enabled() && last->problemKey == solverProblemKey(veh, sol, opt)) {
+        cache.importEntries(last->cache);
+        warmCacheEntries = last->cache.size();
+    }
+
+    // The best Individuals of the previous run, moved inside the current bounds and solved again.
+    // Their converged state is a close guess after a small change, so most of them converge at once.
+    size_t share = static_cast<size_t>(ceil(popSize * max(0.0, min(opt.WarmStartShare, 1.0))));
+    size_t count = min(share, last->population.size());
+    Population batch;
+    batch.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        Individual ind = last->population[i];
+        ind.delta = clamp(ind.delta, minDelta, maxDelta);
+        ind.alpha_F_guess = clamp(ind.alpha_F_guess, minAlpha, maxAlpha);
+        ind.alpha_R_guess = clamp(ind.alpha_R_guess, minAlpha, maxAlpha);
+        ind.kappa_F_guess = clamp(ind.kappa_F_guess, minKappa, maxKappa);
+        ind.kappa_R_guess = clamp(ind.kappa_R_guess, minKappa, maxKappa);
+        ind.fitness = 0.0;
+        ind.converged = false;
+        batch.push_back(ind);
+    }
+    warmOffered = batch.size();
+    BatchPlan plan;
+    evaluateBatch(batch, 0, batch.size(), opt.MultiStarts, plan);
+
+    const double* fitness = batch.fitness();
+    for (size_t i = 0; i < batch.size(); i++) {
+        if (fitness[i] > 0) {
+            seeds.push_back(batch.individual(i));
+        }
+    }
+}
+
+void GeneticAlgorithm::rememberRun() {
+    if (!memory || population.empty()) return;
+
+    auto snapshot = make_shared<RunMemory::Snapshot>();
+    snapshot->problemKey = solverProblemKey(veh, sol, opt);
+    population.argsortByFitness(workspace.order);
+    for (size_t row : workspace.order) {
+        snapshot->population.push_back(population.individual(row));
+    }
+    cache.exportEntries(snapshot->cache);
+    memory->remember(std::move(snapshot));
+}
+
+void GeneticAlgorithm::setCheckpointFile(const QString& path) {
+    checkpointFile = path;
+}
+
+GeneticAlgorithm* GeneticAlgorithm::resume(const QString& path, QString* error) {
+    auto state = make_unique<GaCheckpoint>();
+    if (!readCheckpoint(path, *state, error)) return nullptr;
+
+    GeneticAlgorithm* ga = new GeneticAlgorithm(state->veh, state->opt, state->sol);
+    ga->checkpointFile = path;
+    ga->resumeState = std::move(state);
+    return ga;
+}
+
+void GeneticAlgorithm::saveCheckpoint(int generation, bool background) {
+    if (checkpointFile.isEmpty() || opt.CheckpointInterval <= 0) return;
+    if (background && checkpointWriter.busy()) {
+        checkpointWriter.drop();
+        return;
+    }
+
+    // Only the copy runs on the optimizer thread, the file is written in the background
+    QElapsedTimer timer;
+    timer.start();
+    auto state = make_unique<GaCheckpoint>();
+    state->veh = veh;
+    state->opt = opt;
+    state->sol = sol;
+    state->seed = seed;
+    state->generation = generation;
+    state->elapsedSeconds = resumedSeconds + runTimer.nsecsElapsed() * 1e-9;
+    state->solveCount = solveCount;
+    state->initSamples = initSamples;
+    state->initFeasible = initFeasible;
+    state->population = population;
+    state->stagnation = stagnation;
+    state->adaptation = workspace.adaptation;
+    state->adaptationTrace = adaptationTrace;
+    {
+        lock_guard<mutex> lock(traceMutex);
+        state->bestFound = bestFound;
+        state->bestTrace = bestTrace;
+    }
+    cache.exportEntries(state->cache);
+    size_t ring = 0;
+    workspace.surrogate.exportPoints(state->surrogatePoints, state->surrogateFitness, state->surrogateConverged, ring);
+    state->surrogateNext = ring;
+    state->surrogatePredictions = surrogatePredictions.load();
+    state->surrogateScreened = surrogateScreened.load();
+    checkpointNanos += timer.nsecsElapsed();
+
+    checkpointWriter.submit(checkpointFile, std::move(state));
+    if (!background) {
+        checkpointWriter.wait();
+    }
+}
+
+void GeneticAlgorithm::restoreCheckpoint() {
+    GaCheckpoint& state = *resumeState;
+    seed = state.seed;
+    firstGeneration = state.generation;
+    resumedSeconds = state.elapsedSeconds;
+    solveCount = state.solveCount;
+    initSamples = state.initSamples;
+    initFeasible = state.initFeasible;
+    population = std::move(state.population);
+    stagnation = state.stagnation;
+    workspace.adaptation = state.adaptation;
+    adaptationTrace = state.adaptationTrace;
+    bestFound = state.bestFound;
+    bestOrder = 0;      // Came before anything the resumed run breeds
+    bestTrace = state.bestTrace;
+    cache.importEntries(state.cache);
+    // run() has already reset the surrogate to the bounds of the saved configuration
+    workspace.surrogate.importPoints(state.surrogatePoints, state.surrogateFitness, state.surrogateConverged, state.surrogateNext);
+    surrogatePredictions = state.surrogatePredictions;
+    surrogateScreened = state.surrogateScreened;
+    progress.recordBest(bestFound.fitness);
+    progress.advance(static_cast<size_t>(firstGeneration + 1) * popSize);
+    resumedRun = true;
+    resumeState.reset();    // A second run() starts from scratch
+}
+
+QString GeneticAlgorithm::engineName() const {
+    return "Genetic Algorithm";
+}
+
+bool GeneticAlgorithm::reproducible() const {
+    // Steady-state children and island migrants arrive in thread order, a warm start depends on the previous run
+    if (opt.SteadyState || opt.Islands > 1 || resumeState) return false;
+    bool warmStart = memory && !opt.ColdStart && memory->recall();
+    return !warmStart && OptimizerEngine::reproducible();
+}
+
+QString GeneticAlgorithm::engineReport() const {
+    QString report;
+    report += QString("Generations: %1\n").arg(opt.GenNum);
+    report += QString("Population Size: %1\n").arg(opt.PopSize);
+    report += QString("Multi-start Guesses: %1\n").arg(opt.MultiStarts);
+    report += initializationReport();
+    if (opt.SteadyState) {
+        report += "Model: Steady-state (asynchronous)\n";
+        report += QString("Children Inserted: %1\n").arg(replacements.load());
+    } else if (opt.Islands > 1) {
+        report += "Model: Island\n";
+        const char* topology = (opt.Topology == MigrationTopology::FullyConnected) ? "fully connected"
+                             : (opt.Topology == MigrationTopology::Random) ? "random" : "ring";
+        report += QString("Islands: %1 (%2 topology, %3 migrants every %4 generations)\n").arg(opt.Islands).arg(topology)
+                      .arg(opt.MigrationCount).arg(opt.MigrationInterval);
+        report += QString("Migrants Accepted: %1\n").arg(migrantsAccepted.load());
+    }
+    report += QString("Evaluation Threads: %1\n").arg(scheduler->workerCount());
+    report += QString("Solver Calls: %1\n").arg(solveCount.load());
+    if (opt.Islands > 1 && !opt.SteadyState) {
+        report += QString("Islands Stopped Early: %1 of %2\n").arg(islandsStoppedEarly.load()).arg(opt.Islands);
+    } else {
+        report += stoppingReport(stagnation);
+    }
+    if (cache.enabled()) {
+        size_t lookups = cache.hits() + cache.misses();
+        double hitRate = lookups > 0 ? 100.0 * cache.hits() / lookups : 0.0;
+        report += QString("Fitness Cache Hits: %1 of %2 (%3 %)\n").arg(cache.hits()).arg(lookups).arg(hitRate, 0, 'f', 1);
+    }
+    if (opt.RejectDuplicates) {
+        report += QString("Duplicates Rejected: %1\n").arg(duplicatesRejected.load());
+    }
+    if (opt.Surrogate && !opt.SteadyState) {
+        size_t predicted = surrogatePredictions.load();
+        size_t screened = surrogateScreened.load();
+        double saved = predicted > 0 ? 100.0 * screened / predicted : 0.0;
+        report += QString("Surrogate Evaluations: %1 (%2 children screened out, %3 %)\n").arg(predicted).arg(screened).arg(saved, 0, 'f', 1);
+        report += QString("Real Evaluations: %1\n").arg(solveCount.load());
+    }
+    if (!entropyTrace.empty()) {
+        double lowest = *min_element(entropyTrace.begin(), entropyTrace.end());
+        report += QString("Delta Entropy: %1 first, %2 lowest, %3 last (%4 bins)\n").arg(entropyTrace.front(), 0, 'f', 2)
+                      .arg(lowest, 0, 'f', 2).arg(entropyTrace.back(), 0, 'f', 2).arg(opt.EntropyBins);
+    }
+    for (size_t i = 0; i < islandEntropyTrace.size(); i++) {
+        const vector<double>& trace = islandEntropyTrace[i];
+        if (trace.empty()) continue;    // The island did not converge at the start
+        double lowest = *min_element(trace.begin(), trace.end());
+        report += QString("Island %1 Delta Entropy: %2 first, %3 lowest, %4 last (%5 bins)\n").arg(i + 1).arg(trace.front(), 0, 'f', 2)
+                      .arg(lowest, 0, 'f', 2).arg(trace.back(), 0, 'f', 2).arg(opt.EntropyBins);
+    }
+    if (opt.Niching != NichingMethod::None) {
+        const char* method = (opt.Niching == NichingMethod::Clearing) ? "clearing" : "sharing";
+        report += QString("Niching: %1, radius %2 degrees\n").arg(method).arg(radToDegree(opt.NicheRadius));
+    }
+    report += QString("Delta Niches in Final Population: %1\n").arg(finalNiches);
+    if (opt.MinDeltaEntropy > 0.0) {
+        report += QString("Diversity Injections: %1 below entropy %2 (%3 of %4 fresh samples converged)\n").arg(injections.load())
+                      .arg(opt.MinDeltaEntropy).arg(injectedAccepted.load()).arg(injectedSolved.load());
+    }
+    if (opt.AdaptiveOperators && !adaptationTrace.empty()) {
+        // Scales used by the next generation and the success rates that set them, up to ten steps of every population
+        report += QString("Operator Adaptation: 1/5th success rule, factor %1\n").arg(opt.AdaptationFactor);
+        report += "Mutation Step and Crossover Spread Scales:\n";
+        vector<AdaptationStep> steps = adaptationTrace;
+        stable_sort(steps.begin(), steps.end(), [](const AdaptationStep& a, const AdaptationStep& b) { return a.island < b.island; });
+        for (size_t begin = 0; begin < steps.size();) {
+            size_t end = begin;
+            while (end < steps.size() && steps[end].island == steps[begin].island) end++;
+            size_t stride = max<size_t>(1, (end - begin) / 10);
+            for (size_t i = begin; i < end; i++) {
+                if ((i - begin) % stride != 0 && i + 1 != end) continue;
+                const AdaptationStep& step = steps[i];
+                QString population = step.island > 0 ? QString("Island %1, ").arg(step.island) : QString();
+                report += QString("  %1Generation %2: step x%3, spread x%4 (%5 % of mutations, %6 % of children improved)\n").arg(population)
+                              .arg(step.generation).arg(step.stepScale, 0, 'f', 3).arg(step.spreadScale, 0, 'f', 3)
+                              .arg(100.0 * step.mutationSuccess, 0, 'f', 0).arg(100.0 * step.crossoverSuccess, 0, 'f', 0);
+            }
+            begin = end;
+        }
+    }
+    if (opt.Memetic) {
+        report += QString("Memetic Searches: %1 (%2 improved an elite, %3 solver calls)\n").arg(memeticSearches.load())
+                      .arg(memeticImproved.load()).arg(memeticSolves.load());
+    }
+    return report;
+}
+
+QString GeneticAlgorithm::telemetryReport() const {
+    QString report;
+    if (opt.ColdStart) {
+        report += "Warm Start: off (cold start)\n";
+    } else if (warmOffered > 0) {
+        report += QString("Warm Start: %1 of %2 Individuals of the previous run converged again\n").arg(seeds.size()).arg(warmOffered);
+        if (warmCacheEntries > 0) {
+            report += QString("Solver Results Reused: %1 (same vehicle and solver settings)\n").arg(warmCacheEntries);
+        }
+    }
+    if (resumedRun) {
+        report += QString("Resumed from Generation: %1\n").arg(firstGeneration);
+    }
+    if (!checkpointFile.isEmpty() && opt.CheckpointInterval > 0 && !opt.SteadyState && opt.Islands <= 1) {
+        // The copy is the only cost the optimizer pays, it should stay well under 1% of the run
+        double runSeconds = runTimer.nsecsElapsed() * 1e-9;
+        double copySeconds = checkpointNanos * 1e-9;
+        double share = runSeconds > 0.0 ? 100.0 * copySeconds / runSeconds : 0.0;
+        report += QString("Checkpoints: %1 written every %2 generations (%3 dropped while busy, %4 failed)\n").arg(checkpointWriter.written())
+                      .arg(opt.CheckpointInterval).arg(checkpointWriter.dropped()).arg(checkpointWriter.failed());
+        report += QString("Checkpoint Cost: %1 ms on the optimizer thread (%2 % of the run), %3 ms writing in the background\n")
+                      .arg(1000.0 * copySeconds, 0, 'f', 1).arg(share, 0, 'f', 2).arg(1000.0 * checkpointWriter.writeSeconds(), 0, 'f', 1);
+    }
+    report += OptimizerEngine::telemetryReport();
+
+    // Convergence per wall-clock second, comparable between the generational, island and steady-state runs
+    lock_guard<mutex> lock(traceMutex);
+    if (!bestTrace.empty()) {
+        double wallTime = resumedSeconds + runTimer.nsecsElapsed() * 1e-9;
+        double finalBest = bestTrace.back().second;
+        double timeTo99 = bestTrace.back().first;
+        for (const auto& point : bestTrace) {
+            if (point.second >= 0.99 * finalBest) {
+                timeTo99 = point.first;
+                break;
             }
         }
-        if (noSolution) break;
+        report += QString("Wall Time: %1 s\n").arg(wallTime, 0, 'f', 2);
+        if (wallTime > 0.0) {
+            report += QString("Solves per Second: %1\n").arg(solveCount.load() / wallTime, 0, 'f', 1);
+        }
+        report += QString("Time to 99% of Best: %1 s\n").arg(timeTo99, 0, 'f', 2);
+        report += "Best Velocity over Time:\n";
+        size_t stride = max<size_t>(1, bestTrace.size() / 10);
+        for (size_t i = 0; i < bestTrace.size(); i += stride) {
+            report += QString("  %1 s: %2 m/s\n").arg(bestTrace[i].first, 0, 'f', 2).arg(bestTrace[i].second);
+        }
+        if ((bestTrace.size() - 1) % stride != 0) {
+            report += QString("  %1 s: %2 m/s\n").arg(bestTrace.back().first, 0, 'f', 2).arg(bestTrace.back().second);
+        }
+    }
+    return report;
+}
+
+void GeneticAlgorithm::run() {
+    // --- 1. INITIALIZATION ---
+    progress.start(100.0 / ((generations + 1) * popSize));      // Progress step is calculate with the number of individual needed to create the population
+    stagnation = StagnationMonitor(opt);
+    islandsStoppedEarly = 0;
+    initSamples = 0;
+    initFeasible = 0;
+    population.clear(); 
+    population.reserve(popSize);
+    nextPopulation.clear();
+    nextPopulation.reserve(popSize);
+    solveCount = 0;
+    duplicatesRejected = 0;
+    surrogatePredictions = 0;
+    surrogateScreened = 0;
+    memeticSearches = 0;
+    memeticImproved = 0;
+    memeticSolves = 0;
+    injections = 0;
+    injectedSolved = 0;
+    injectedAccepted = 0;
+    entropyTrace.clear();
+    islandEntropyTrace.clear();
+    adaptationTrace.clear();
+    workspace.adaptation = OperatorAdaptation(opt);
+    finalNiches = 0;
+    workspace.surrogate.reset(opt);
+    cache.clear();
+    migrantsAccepted = 0;
+    replacements = 0;
+    scheduler->resetStats();
+    bestTrace.clear();
+    bestFound = Individual();
+    bestOrder = 0;
+    batches = 0;
+    cancellation->start(opt.TimeBudget);
+    seed = drawSeed();     // Every random decision derives from the seed, so reporting it makes the run reproducible
+    firstGeneration = 0;
+    resumedSeconds = 0.0;
+    resumedRun = false;
+    checkpointNanos = 0;
+    checkpointWriter.resetStats();
+    runTimer.start();
+
+    if (!resumeState) {
+        prepareWarmStart();
+    }
+
+    if (resumeState) {
+        // --- 2. CONTINUE A SAVED RUN ---
+        restoreCheckpoint();
+        noSolution = population.empty();
+    } else if (opt.SteadyState) {
+        // --- 2-3. STEADY-STATE MODEL ---
+        noSolution = !runSteadyState();
+    } else if (opt.Islands > 1) {
+        // --- 2-3. ISLAND MODEL ---
+        noSolution = !runIslands();
+    } else {
+        // --- 2. GENERATE INITIAL POPULATION ---
+        noSolution = !initializePopulation(population, popSize, 0);
+        if (!noSolution && !stopRequested()) {
+            saveCheckpoint(0, true);
+        }
+    }
+
+    // A run stopped during the initialization still returns its best Individual
+    if (noSolution && stopRequested() && bestFound.fitness > 0) {
+        noSolution = false;
+        population.clear();
+        population.push_back(bestFound);
     }
 
     // If initial population failed, exit early and update progress
     if (noSolution) {
-        emit summaryReady(generateSummary(Individual(), veh, opt, sol));
+        // The feasible fraction tells whether the configuration is hopeless or just needs a larger budget
+        emit summaryReady(generateSummary(Individual()) + initializationReport());
         emit progressChanged(100);
         emit finished();
         return;
@@ -234,86 +1403,85 @@ void GeneticAlgorithm::run() {
 
 
     // --- 3. GENERATIONAL LOOP ---
-        for (int gen = 0; gen < generations; gen++) {
-            evaluateFitness();      // Sort the current population.
-
-            vector<Individual> newPopulation;
-
-            // Elitism: Preserve the best individuals.
-            int elite_count = popSize / 20;
-            for (int i = 0; i < elite_count; i++) {
-                newPopulation.push_back(population[i]);
-                updateProgress();
+        if (!opt.SteadyState && opt.Islands <= 1) {
+            if (!resumedRun) {
+                stagnation.update(0, population.fitness(), population.gene(Gene::Delta), population.size());
+                entropyTrace.push_back(deltaEntropy(population.gene(Gene::Delta), population.fitness(), population.size(),
+                                                    minDelta, maxDelta, opt.EntropyBins, workspace.histogram));
             }
-
-            // Mutate some of the best individuals to explore nearby solutions.
-            int mutation_count = popSize / 20;
-            for (int i = 0; i < mutation_count; i++) {
-                Individual clone = population[i % 5];
-                mutate(clone);
-                solveIndividual(clone, veh, sol, opt);
-                if (clone.fitness != 0) {
-                    newPopulation.push_back(clone);
-                    updateProgress();
+            int completed = firstGeneration;
+            for (int gen = firstGeneration; gen < generations && !stopRequested(); gen++) {
+                if (!evolveGeneration(population, nextPopulation, popSize, 0, gen + 1, workspace)) {
+                    break;
                 }
-            }
-
-            // Crossover: Fill the rest of the population with children.
-            while (newPopulation.size() < popSize) {
-                Individual parent1 = tournamentSelection(population, 3);
-                Individual parent2 = tournamentSelection(population, 3);
-                Individual child;
-                crossover(parent1, parent2, child);
-                solveIndividual(child, veh, sol, opt);
-                if (child.fitness > 0) {
-                    newPopulation.push_back(child);
-                    updateProgress();
+                completed = gen + 1;
+                if (memeticDue(gen + 1)) {
+                    refineElites(population, workspace);
+                }
+                entropyTrace.push_back(maintainDiversity(population, 0, gen + 1, workspace));
+                if (opt.AdaptiveOperators) {
+                    adaptationTrace.push_back(workspace.adaptation.lastStep());
+                }
+                if (stagnation.update(gen + 1, population.fitness(), population.gene(Gene::Delta), population.size())) {
+                    break;
+                }
+                if (opt.CheckpointInterval > 0 && completed % opt.CheckpointInterval == 0) {
+                    saveCheckpoint(completed, true);
                 }
+                // The progress bar follows the generation where the trend says the run will stop
+                progress.setStep(100.0 / ((stagnation.estimatedEnd(generations) + 1) * popSize));
             }
-            
-            population = newPopulation;
+            // The last complete generation is saved before returning, a stopped run can be resumed from it
+            saveCheckpoint(completed, false);
         }
         // THIS LOOP ENDS WHEN THE DESIRED NUMBER OF INDIVIDUALS IS ACHIEVED
 
-        evaluateFitness(); // Organizes the final population
+        // The GA only has to find the right basin, the final local search gives the precise delta
+        if (opt.Memetic) {
+            refineElites(population, workspace);
+        }
+
+        // Equilibrium branches still held by the final population
+        finalNiches = countNiches(population.gene(Gene::Delta), population.fitness(), population.size(), opt.NicheRadius, workspace.sortedDelta);
+
+        // The best Individual, with all its results, was kept by recordBest() while solving
+        bestIndividual = bestFound;
+        rememberRun();
             
 
         /* DEBUG TOOL
         cout << "\n\n==================================================" << endl;
         cout << "               FINAL OPTIMIZED RESULT" << endl;
         cout << "==================================================" << endl;
-        cout << "\nMax Velocity: " << population[0].fitness << " m/s"
-             << "\nMax Vx: " << population[0].Vx << " m/s"
-             << "\nMax Vy: " << population[0].Vy << " m/s"
-             << "\nMax acc: " << population[0].ay << "m/s^2"
-             << "\nOptimized Delta: " << population[0].delta << " degrees\n"
-             << "\nBeta: " << population[0].beta << "RAD\n"
-             << "\nOptimized Front Lateral Tire Force: " << population[0].MF_Fy_F << " N"
-             << "\nOptimized Rear Lateral Tire Force: " << population[0].MF_Fy_R << " N"
-             << "\nOptimized Front Longitudinal Tire Force: " << population[0].MF_Fx_F << " N"
-             << "\nOptimized Rear Longitudinal Tire Force: " << population[0].MF_Fx_R << " N"
-             << "\nLoad Distribution on the front tire: " << population[0].Fz_F << " N"
-             << "\nLoad Distribution on the rear tire: " << population[0].Fz_R << " N"
-             << "\nFront Slip Angle: " << population[0].alpha_F  << " degree"
-             << "\nRear Slip Angle: " << population[0].alpha_R  << " degree"
-             << "\nFront Slip Ratio: " << population[0].kappa_F << " [-]"
-             << "\nRear Slip Ratio: " << population[0].kappa_R << " [-]";
+        cout << "\nMax Velocity: " << bestIndividual.fitness << " m/s"
+             << "\nMax Vx: " << bestIndividual.Vx << " m/s"
+             << "\nMax Vy: " << bestIndividual.Vy << " m/s"
+             << "\nMax acc: " << bestIndividual.ay << "m/s^2"
+             << "\nOptimized Delta: " << bestIndividual.delta << " degrees\n"
+             << "\nBeta: " << bestIndividual.beta << "RAD\n"
+             << "\nOptimized Front Lateral Tire Force: " << bestIndividual.MF_Fy_F << " N"
+             << "\nOptimized Rear Lateral Tire Force: " << bestIndividual.MF_Fy_R << " N"
+             << "\nOptimized Front Longitudinal Tire Force: " << bestIndividual.MF_Fx_F << " N"
+             << "\nOptimized Rear Longitudinal Tire Force: " << bestIndividual.MF_Fx_R << " N"
+             << "\nLoad Distribution on the front tire: " << bestIndividual.Fz_F << " N"
+             << "\nLoad Distribution on the rear tire: " << bestIndividual.Fz_R << " N"
+             << "\nFront Slip Angle: " << bestIndividual.alpha_F  << " degree"
+             << "\nRear Slip Angle: " << bestIndividual.alpha_R  << " degree"
+             << "\nFront Slip Ratio: " << bestIndividual.kappa_F << " [-]"
+             << "\nRear Slip Ratio: " << bestIndividual.kappa_R << " [-]";
             
              std::cout << "Residuals:\n";
             for (int i = 0; i < 7; i++) {
-                std::cout << "r[" << i << "] = " << population[0].residuals[i] << "\n";
+                std::cout << "r[" << i << "] = " << bestIndividual.residuals[i] << "\n";
             }
         */
-        
-        bestIndividual = population[0];
-        cout << bestIndividual.fitness << endl;
 
         // Generate the summary report.
-        QString summary = generateSummary(population[0], veh, opt, sol);
+        QString summary = generateSummary(bestIndividual);
 
         // Emit signals to notify the GUI that the process is complete.
         emit optimizationFinished(bestIndividual);
         emit progressChanged(100);
-        emit summaryReady(summary);
+        emit summaryReady(summary + storeResult());
         emit finished();
 }
\ No newline at end of file
@@ -3,9 +3,22 @@
 #pragma once
 
 #include "src/model/eqn_solver.h"
+#include "src/model/optimizer_engine.h"
 #include "src/controller/simulation_inputs.h"
 #include "src/Model/tire_model.h"
 #include "src/Controller/input_manager.h"
+#include "src/Model/task_scheduler.h"
+#include "src/Model/population.h"
+#include "src/Model/fitness_cache.h"
+#include "src/Model/stagnation_monitor.h"
+#include "src/Model/sampling.h"
+#include "src/Model/philox.h"
+#include "src/Model/surrogate_model.h"
+#include "src/Model/brent_optimizer.h"
+#include "src/Model/checkpoint.h"
+#include "src/Model/run_memory.h"
+#include "src/Model/niching.h"
+#include "src/Model/operator_adaptation.h"
 
 #include <iostream>
 #include <cmath>
@@ -14,7 +27,13 @@
 #include <ctime>
 #include <algorithm>
 #include <random>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <utility>
 #include <QObject>
+#include <QElapsedTimer>
+#include <QThread>
 
 /**
  * @brief Compares two Individual structs based on their fitness.
@@ -26,6 +45,32 @@
 
 bool compareFitness(const Individual& a, const Individual& b);
 
+/**
+ * @class MigrationMailbox
+ * @brief Lock-free multiple-producer single-consumer queue of migrants between islands.
+ * Any island can post() a group of migrants at any time; only the owner island calls collect(),
+ * which takes every pending group at once. Islands never wait for each other.
+ */
+
+class MigrationMailbox {
+public:
+    MigrationMailbox() = default;
+    ~MigrationMailbox();
+
+    MigrationMailbox(const MigrationMailbox&) = delete;
+    MigrationMailbox& operator=(const MigrationMailbox&) = delete;
+
+    void post(std::vector<Individual> migrants);    //!< Pushes a group of migrants, safe from any thread.
+    std::vector<Individual> collect();              //!< Takes all the pending migrants in arrival order, owner thread only.
+
+private:
+    struct Node {
+        std::vector<Individual> migrants;
+        Node* next;
+    };
+    std::atomic<Node*> head{nullptr};       //!< Treiber stack, emptied with a single exchange so there is no ABA problem
+};
+
 /**
  * @class GeneticAlgorithm
  * @brief Implements a genetic algorithm to optimize vehicle performance.
@@ -33,35 +78,146 @@ bool compareFitness(const Individual& a, const Individual& b);
  * This class uses principles of evolution—selection, crossover, and mutation—to
  * find the optimal steering angle (delta) and the best initial guesses that can
  * find the best vehicle's cornering velocity, subject to the physical constraints of
- * the vehicle dynamics model. It inherits from QObject to emit signals for GUI updates.
+ * the vehicle dynamics model. It is one of the OptimizerEngine implementations and
+ * reports to the GUI through the signals declared there.
  */
 
-class GeneticAlgorithm : public QObject {
+class GeneticAlgorithm : public OptimizerEngine {
     Q_OBJECT
+    friend class GeneticAlgorithmTest;     // White-box tests of tests/, they drive single generations
 private:
 
-    void updateProgress();      //!< Call to update the progress bar at the GUI
-    void evaluateFitness();     //!< Sorts the population by fitness in descending order.
-    Individual tournamentSelection(const std::vector<Individual>& pop, int tournamentSize);     //!< Selects a parent from the population using a tournament.
-    void crossover(const Individual& parent1, const Individual& parent2, Individual& child);    //!< Creates a child by combining genes from two parents.
-    void mutate(Individual& ind);       //!< Applies small, random changes to an individual's genes.
+    /**
+     * @struct BatchPlan
+     * @brief Buffers of evaluateBatch(), which groups the rows of a batch by cache key before any solve.
+     */
+    struct BatchPlan {
+        std::vector<FitnessCache::Key> keys;    //!< Cache key of every row of the batch
+        std::vector<size_t> order;          //!< Rows sorted by key, then by row
+        std::vector<size_t> source;         //!< First row of the batch with the same key, the row itself for a representative
+        std::vector<size_t> solve;          //!< Representatives missing from the cache, dispatched to the solver
+    };
+
+    /**
+     * @struct Workspace
+     * @brief Buffers reused by the vectorized operators of one evolving population, so the bookkeeping of a generation does not allocate.
+     */
+    struct Workspace {
+        std::vector<size_t> order;          //!< Rows sorted by fitness
+        std::vector<size_t> parent1, parent2;   //!< Rows of the parents of each child
+        std::vector<double> uniform, normal;    //!< Random numbers drawn before each operator pass
+        BatchPlan batch;                    //!< Cache grouping of the rows solved by evaluateBatch()
+
+        // Surrogate pre-screening
+        SurrogateModel surrogate;           //!< Model of the solver fitted on the rows solved by this population
+        Population candidates;              //!< Children bred before the model picks the ones to solve
+        std::vector<SurrogateModel::Point> points;  //!< Scaled genomes of the candidates or of the rows being solved
+        std::vector<double> score;          //!< Predicted expected fitness of every candidate
+        std::vector<size_t> shortlist;      //!< Candidates sorted by score
+
+        // Niching and diversity
+        std::vector<double> niched;         //!< Selection fitness of every row after clearing or sharing
+        std::vector<size_t> histogram;      //!< Delta histogram of the entropy
+        std::vector<double> sortedDelta;    //!< Converged deltas sorted to count the niches
+
+        // Self-adaptive operators
+        OperatorAdaptation adaptation{OptimizationConfig()};   //!< 1/5th success rule of the mutation steps and crossover spread of this population
+        std::vector<double> parentFitness;  //!< Fitness each bred row has to beat to count as a success
+    };
+
+    /**
+     * @struct Island
+     * @brief A sub-population of the island model, evolved by a single task with its own generator.
+     */
+    struct Island {
+        Population population;
+        Population next;                    //!< Second arena, the next generation is built here and swapped with population
+        Workspace work;
+        size_t size = 0;                    //!< Target size of the sub-population
+        uint32_t lineage = 0;               //!< Coordinate that separates the random streams of the islands
+        MigrationMailbox inbox;             //!< Migrants sent by the other islands
+    };
+
+    /**
+     * @struct Slot
+     * @brief One place of the steady-state population, guarded by its own lock.
+     */
+    struct Slot {
+        std::mutex lock;
+        Individual ind;
+    };
+
+    /**
+     * @enum StreamId
+     * @brief Gene coordinate of the random streams that are not a gene mutation (those use the Gene values).
+     */
+    enum StreamId : uint32_t {
+        CrossoverGenes = 8,     //!< 8 + Gene: crossover draws of each gene
+        FirstParent = 16,
+        SecondParent,
+        OperatorChoice,
+        Replacement,
+        Migration,
+        SamplingShift,
+        SamplingDesign,
+        Injection
+    };
+
+    //! Random stream of one decision, a pure function of the run seed and its coordinates.
+    CounterRng stream(uint32_t lineage, uint32_t generation, uint32_t individual, uint32_t id) const;
+
+    void updateProgress();      //!< Call to update the progress bar at the GUI, safe from any thread
+    void recordBest(const Individual& ind, uint64_t order);     //!< Keeps the full Individual and adds a point to bestTrace if it improves the best found so far, equal fitness goes to the lowest order, safe from any thread
+    static uint64_t birthOrder(uint64_t batch, size_t row);     //!< Order of a row of a batch for the ties of recordBest(), earlier batches and lower rows first
+    void evaluateFitness(std::vector<Individual>& pop);     //!< Sorts a vector of Individuals by fitness in descending order.
+    bool solveCached(Individual& ind, int starts);     //!< Solves an Individual or takes its result from the cache, returns true on a cache hit.
+    void solveGenome(Individual& ind, int starts);     //!< Solves an Individual and stores the result in the cache.
+    void evaluateBatch(Population& pop, size_t first, size_t count, int starts, BatchPlan& plan, bool rejectDuplicates = false);    //!< Solves count rows in place in parallel, one solve per cache key, duplicates of solved genomes get zero fitness if asked.
+    size_t keepConverged(Population& arena, size_t first, size_t count);    //!< Compacts the converged rows of a range to its start, returns the new end.
+    void evaluateAndLearn(Population& arena, size_t first, size_t count, int starts, bool rejectDuplicates, Workspace& work);   //!< evaluateBatch() that also trains the surrogate of the population.
+    void screenChildren(const Population& pop, Population& next, size_t first, size_t count, uint32_t lineage, uint32_t generation, uint32_t firstBirth, Workspace& work);  //!< Breeds candidates from work.parent1/parent2 and keeps the count best ranked by the surrogate.
+    bool initializePopulation(Population& pop, size_t size, uint32_t lineage);    //!< Fills the population with converged samples of the configured design, false if the budget finds fewer than 2.
+    QString initializationReport() const;   //!< Sampling design, solver calls and feasible fraction of the initialization.
+    bool evolveGeneration(Population& pop, Population& next, size_t size, uint32_t lineage, uint32_t generation, Workspace& work);   //!< Builds the next generation in the next arena and swaps both, false if a stop left pop unchanged.
+    void mutateRows(Population& pop, size_t first, size_t count, uint32_t lineage, uint32_t generation, uint32_t firstBirth, Workspace& work);     //!< Mutates a range of rows, one pass per gene array.
+    void crossoverRows(const Population& parents, Population& children, size_t first, size_t count, uint32_t lineage, uint32_t generation, uint32_t firstBirth, Workspace& work);  //!< Breeds a range of children from work.parent1/parent2, one pass per gene array.
+    void refineElites(Population& pop, Workspace& work);    //!< Memetic step: local search on the best rows, replaced in place when improved.
+    Individual localSearch(const Individual& elite, uint64_t order);       //!< Brent search on delta around a solved Individual, every solve warm-started from the last converged one.
+    bool memeticDue(int generation) const;  //!< True if the elites are refined after this generation.
+    const double* selectionFitness(const Population& pop, Workspace& work);    //!< Ranks the rows into work.order by their niche fitness and returns it (the plain fitness without niching).
+    double maintainDiversity(Population& pop, uint32_t lineage, uint32_t generation, Workspace& work);    //!< Delta entropy of the population, fresh samples replace the worst rows when it is below MinDeltaEntropy.
+    size_t countImproved(const Population& arena, size_t first, size_t count, const Workspace& work) const;    //!< Bred rows fitter than work.parentFitness, before keepConverged() compacts them.
+    void prepareWarmStart();    //!< Re-solves the best Individuals of the remembered run under the current parameters, the converged ones become seeds.
+    void rememberRun();         //!< Stores the final population and the cache in the RunMemory for the next run.
+    void saveCheckpoint(int generation, bool background);  //!< Copies the run state after a complete generation and hands it to the writer.
+    void restoreCheckpoint();   //!< Continues the run saved in resumeState.
+    bool runIslands();          //!< Island model: evolves the sub-populations in parallel and merges them into population.
+    bool runSteadyState();      //!< Steady-state model: workers breed, solve and insert children asynchronously, the result is copied into population.
+    Individual slotTournament(std::vector<Slot>& places, int tournamentSize, CounterRng& rng);     //!< Tournament selection over the steady-state population, each place read under its lock.
+    bool replaceLoser(std::vector<Slot>& places, const Individual& child, int tournamentSize, CounterRng& rng);   //!< Replaces the worst of a random tournament if the child is better.
+    void migrate(std::vector<std::unique_ptr<Island>>& islands, size_t from, uint32_t generation);   //!< Posts the best Individuals of an island to its destinations.
+    void receiveMigrants(Island& island);   //!< Replaces the worst Individuals of an island with the better migrants received.
+    size_t tournamentSelection(const double* score, size_t n, int tournamentSize, CounterRng& rng);     //!< Selects the row of a parent from the population using a tournament on the selection fitness.
+    void crossover(const Individual& parent1, const Individual& parent2, Individual& child, uint32_t lineage, uint32_t generation, uint32_t birth, double spreadScale);  //!< Creates a single child by combining genes from two parents (steady-state GA).
+    void mutate(Individual& ind, uint32_t lineage, uint32_t generation, uint32_t birth, double stepScale);      //!< Applies small, random changes to a single individual's genes (steady-state GA).
 
-    double randomInRange(double min, double max);           //!< Generates a random double within a specified range.
     double clamp(double value, double minv, double maxv);   //!< Clamps a value between a minimum and maximum.
-    QString generateSummary(Individual best, Vehicle veh, OptimizationConfig opt, SolverConfig sol);    //!< Creates a formatted summary string of the results.
+
+protected:
+    QString engineName() const override;
+    QString engineReport() const override;
+    QString telemetryReport() const override;
+    bool reproducible() const override;
+
+private:
 
     // Private member variables
-    std::vector<Individual> population;     //!< The current population of solutions (vector of individuals).
+    Population population;                  //!< The current population of solutions, stored as one array per gene.
+    Population nextPopulation;              //!< Second arena of the same capacity, the next generation is built in place here and swapped with population.
+    Workspace workspace;                    //!< Operator buffers of the single population
     size_t popSize;                         //!< The number of individuals in the population.
-    Vehicle veh;                            //!< The vehicle's fixed physical parameters.
-    OptimizationConfig opt;                 //!< Configuration for the optimization process.
-    SolverConfig sol;                       //!< Configuration to use in the equation solver.
     int generations;                        //!< The number of generations (later defined with opt).
 
-    double progress_step;                   //!< Step used in progress bar
-    double progress;                        //!< Stored Progrees of the current optimization
-    
-
     // Parameter ranges
     double minDelta;
     double maxDelta;
@@ -70,14 +226,55 @@ private:
     double minKappa;
     double maxKappa;
 
-    // Random number generator
-    std::mt19937 rd;
+    // Seed of the counter-based random streams, every random decision is keyed by (seed, lineage, generation, individual, gene)
+    uint64_t seed;
 
-public:
-    bool noSolution = false;    //!< if it is not possible to find a solution with current configs, it returns true
+    std::atomic<size_t> solveCount;         //!< Number of Individuals sent to the solver in this run
+    FitnessCache cache;                     //!< Solver results of the genomes already evaluated in this run
+    std::atomic<size_t> duplicatesRejected; //!< Clones and children dropped because their genome was already solved
+    std::atomic<size_t> surrogatePredictions;   //!< Candidate children evaluated by the surrogate instead of the solver
+    std::atomic<size_t> surrogateScreened;  //!< Candidates discarded by the surrogate without a solve
+    std::atomic<size_t> memeticSearches;    //!< Local searches run on elites
+    std::atomic<size_t> memeticImproved;    //!< Local searches that found a faster Individual
+    std::atomic<size_t> memeticSolves;      //!< Solver calls spent by the local searches
+    std::atomic<size_t> injections;         //!< Diversity injections triggered by a low delta entropy
+    std::atomic<size_t> injectedSolved;     //!< Fresh samples solved by the injections
+    std::atomic<size_t> injectedAccepted;   //!< Fresh samples that converged and replaced a row
+    std::vector<double> entropyTrace;       //!< Delta entropy of the single population after every generation
+    std::vector<std::vector<double>> islandEntropyTrace;    //!< Delta entropy of every island after every generation, one trace per island
+    std::vector<AdaptationStep> adaptationTrace;    //!< Operator scales after every generation, of every island (guarded by traceMutex while the islands run)
+    size_t finalNiches = 0;                 //!< Delta niches of the final population
+
+    std::atomic<size_t> initSamples;        //!< Candidates solved while building the initial population(s)
+    std::atomic<size_t> initFeasible;       //!< Candidates that converged among them
+
+    StagnationMonitor stagnation;           //!< Early termination of the single population and of the steady-state GA
+    std::atomic<size_t> islandsStoppedEarly;    //!< Islands that stopped before GenNum generations
+    std::atomic<size_t> migrantsAccepted;   //!< Migrants that replaced an Individual of the destination island
+    std::atomic<size_t> replacements;       //!< Steady-state children that replaced a tournament loser
 
-    Individual bestIndividual;  //!< Best Individual of the population is stored here
+    std::shared_ptr<RunMemory> memory;      //!< Previous run of the same SimulationContext, null disables the warm start
+    std::vector<Individual> seeds;          //!< Re-converged Individuals of the previous run, placed first in the initial population
+    size_t seedLanes = 1;                   //!< Populations that share the seeds (the islands)
+    size_t warmOffered = 0;                 //!< Individuals of the previous run re-solved at the start
+    size_t warmCacheEntries = 0;            //!< Cache entries reused because the solver problem did not change
 
+    QString checkpointFile;                 //!< Checkpoints are written here, empty disables them
+    std::unique_ptr<GaCheckpoint> resumeState;  //!< Saved run continued by the next call to run()
+    int firstGeneration = 0;                //!< Generations already completed when the loop starts (a resumed run)
+    CheckpointWriter checkpointWriter;      //!< Background writer of the checkpoints
+    long long checkpointNanos = 0;          //!< Time the optimizer thread spent copying the state for the checkpoints
+    double resumedSeconds = 0.0;            //!< Run time before the resume, added to the elapsed times
+    bool resumedRun = false;                //!< True if the current run continues a checkpoint
+
+    QElapsedTimer runTimer;                 //!< Wall-clock time of the current run
+    mutable std::mutex traceMutex;          //!< Guards bestTrace, bestFound, bestOrder and the traces the islands append to
+    Individual bestFound;                   //!< Full solved Individual with the highest fitness of the run
+    uint64_t bestOrder = 0;                 //!< birthOrder() of bestFound, the lowest one wins a tie
+    std::atomic<uint64_t> batches{0};       //!< Batches solved in this run, the first coordinate of birthOrder()
+    std::vector<std::pair<double, double>> bestTrace;  //!< (elapsed seconds, best fitness) at every improvement of the run
+
+public:
     /**
      * @brief Constructor for the GeneticAlgorithm class.
      * @param vehicle The Vehicle object with fixed parameters.
@@ -90,31 +287,28 @@ public:
     /**
      * @brief The main entry point to start the genetic algorithm optimization.
      */
-    void run();
+    void run() override;
 
-signals:
     /**
-     * @brief Emitted periodically to update a progress bar in the GUI.
-     * @param value The current progress percentage (0-100).
+     * @brief Enables periodic checkpoints of the generational GA to a file.
+     * @param path The checkpoint file, replaced at every checkpoint (empty disables them).
      */
-    void progressChanged(int value);  
+    void setCheckpointFile(const QString& path);
 
     /**
-     * @brief Emitted when the entire optimization process has finished.
+     * @brief Shares the memory of the previous runs of the same context.
+     * The run is seeded from it unless OptimizationConfig::ColdStart is set, and leaves its own result in it.
      */
-    void finished();                 
+    void setRunMemory(std::shared_ptr<RunMemory> runMemory);
 
     /**
-     * @brief Emitted when the optimization is finished, carrying the best result.
-     * @param best The best Individual found by the algorithm.
-     */
-    void optimizationFinished(const Individual& best);
-    
-    /**
-     * @brief Emitted when the final summary report is ready.
-     * @param summary A formatted QString containing the detailed results.
+     * @brief Creates a GeneticAlgorithm that continues the run saved in a checkpoint file.
+     * The vehicle and configurations are the saved ones, and the run keeps checkpointing to the same file.
+     * @param path The checkpoint file.
+     * @param error Receives the reason of a failure, may be null.
+     * @return The engine, owned by the caller, or nullptr if the file can not be read.
      */
-    void summaryReady(QString summary);
+    static GeneticAlgorithm* resume(const QString& path, QString* error = nullptr);
 };
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "src/Model/niching.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+void nicheFitness(NichingMethod method, const double* fitness, const double* delta, const size_t* byFitness, size_t n,
+                  double radius, int capacity, double* adjusted) {
+    copy(fitness, fitness + n, adjusted);
+    if (method == NichingMethod::None || radius <= 0.0) return;
+
+    if (method == NichingMethod::Clearing) {
+        // The best remaining row of a niche is its winner, the rows it dominates lose their fitness
+        size_t winnersAllowed = static_cast<size_t>(max(capacity, 1));
+        for (size_t a = 0; a < n; a++) {
+            size_t i = byFitness[a];
+            if (adjusted[i] <= 0.0) continue;
+            size_t winners = 1;
+            for (size_t b = a + 1; b < n; b++) {
+                size_t j = byFitness[b];
+                if (adjusted[j] <= 0.0 || abs(delta[i] - delta[j]) >= radius) continue;
+                if (winners < winnersAllowed) {
+                    winners++;
+                } else {
+                    adjusted[j] = 0.0;
+                }
+            }
+        }
+        return;
+    }
+
+    // Sharing: triangular kernel, a row alone in its niche keeps its fitness
+    for (size_t i = 0; i < n; i++) {
+        if (fitness[i] <= 0.0) continue;
+        double nicheCount = 0.0;
+        for (size_t j = 0; j < n; j++) {
+            double d = abs(delta[i] - delta[j]);
+            if (fitness[j] > 0.0 && d < radius) nicheCount += 1.0 - d / radius;
+        }
+        adjusted[i] = fitness[i] / nicheCount;
+    }
+}
+
+double deltaEntropy(const double* delta, const double* fitness, size_t n, double minDelta, double maxDelta, int bins, vector<size_t>& counts) {
+    bins = max(bins, 1);
+    counts.assign(bins, 0);
+    double width = (maxDelta - minDelta) / bins;
+    size_t rows = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (fitness[i] <= 0.0) continue;
+        int bin = width > 0.0 ? static_cast<int>((delta[i] - minDelta) / width) : 0;
+        counts[min(max(bin, 0), bins - 1)]++;
+        rows++;
+    }
+
+    // A population smaller than the histogram can at best fill one bin per row
+    size_t reachable = min<size_t>(bins, rows);
+    if (reachable < 2) return 0.0;
+    double entropy = 0.0;
+    for (size_t c : counts) {
+        if (c == 0) continue;
+        double p = static_cast<double>(c) / rows;
+        entropy -= p * log(p);
+    }
+    return entropy / log(static_cast<double>(reachable));
+}
+
+size_t countNiches(const double* delta, const double* fitness, size_t n, double radius, vector<double>& sorted) {
+    sorted.clear();
+    for (size_t i = 0; i < n; i++) {
+        if (fitness[i] > 0.0) sorted.push_back(delta[i]);
+    }
+    if (sorted.empty()) return 0;
+    sort(sorted.begin(), sorted.end());
+    size_t niches = 1;
+    for (size_t i = 1; i < sorted.size(); i++) {
+        if (sorted[i] - sorted[i - 1] >= radius) niches++;
+    }
+    return niches;
+}
@@ -0,0 +1,51 @@
+#ifndef NICHING_H
+#define NICHING_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <cstddef>
+#include <vector>
+
+/*
+    niching keeps several delta branches alive in a GA population: the selection
+    fitness of an Individual depends on how crowded its delta niche is, and the
+    delta entropy measures how much of the range the population still covers
+*/
+
+/**
+ * @brief Selection fitness of every row after clearing or fitness sharing on delta.
+ * Clearing keeps the fitness of the best capacity rows of every niche and sets the others to 0.
+ * Sharing divides the fitness by the niche count sum(1 - d / radius) over the rows closer than radius.
+ * @param method Clearing or Sharing (None copies the fitness).
+ * @param fitness Fitness of every row.
+ * @param delta Delta of every row.
+ * @param byFitness Rows ordered by fitness, highest first (Population::argsortByFitness()).
+ * @param n Number of rows.
+ * @param radius Delta distance [rad] inside which two rows share a niche.
+ * @param capacity Winners kept by each niche under clearing.
+ * @param adjusted Output, n selection fitness values.
+ */
+void nicheFitness(NichingMethod method, const double* fitness, const double* delta, const size_t* byFitness, size_t n,
+                  double radius, int capacity, double* adjusted);
+
+/**
+ * @brief Normalized Shannon entropy of the delta histogram of the converged rows.
+ * @param delta Delta of every row.
+ * @param fitness Fitness of every row, rows with zero fitness are ignored.
+ * @param n Number of rows.
+ * @param minDelta Lower bound of the histogram.
+ * @param maxDelta Upper bound of the histogram.
+ * @param bins Number of bins.
+ * @param counts Histogram buffer, only reallocated if it is too small.
+ * @return 0 when every row falls in one bin, 1 when the rows are spread evenly over min(bins, rows) bins.
+ */
+double deltaEntropy(const double* delta, const double* fitness, size_t n, double minDelta, double maxDelta, int bins, std::vector<size_t>& counts);
+
+/**
+ * @brief Number of delta niches of the converged rows: clusters whose neighbours are closer than radius.
+ * @param sorted Buffer for the sorted deltas, only reallocated if it is too small.
+ */
+size_t countNiches(const double* delta, const double* fitness, size_t n, double radius, std::vector<double>& sorted);
+
+#endif
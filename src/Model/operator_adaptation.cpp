@@ -0,0 +1,38 @@
+#include "src/Model/operator_adaptation.h"
+
+#include <algorithm>
+
+using namespace std;
+
+OperatorAdaptation::OperatorAdaptation(const OptimizationConfig& opt)
+    : enabled(opt.AdaptiveOperators), factor(max(opt.AdaptationFactor, 1.0)),
+      minScale(opt.MinOperatorScale), maxScale(max(opt.MaxOperatorScale, opt.MinOperatorScale)) {}
+
+void OperatorAdaptation::recordMutations(size_t trials, size_t successes) {
+    mutationTrials += trials;
+    mutationSuccesses += successes;
+}
+
+void OperatorAdaptation::recordCrossovers(size_t trials, size_t successes) {
+    crossoverTrials += trials;
+    crossoverSuccesses += successes;
+}
+
+AdaptationStep OperatorAdaptation::endGeneration(int generation) {
+    last.generation = generation;
+    last.mutationSuccess = mutationTrials > 0 ? static_cast<double>(mutationSuccesses) / mutationTrials : 0.0;
+    last.crossoverSuccess = crossoverTrials > 0 ? static_cast<double>(crossoverSuccesses) / crossoverTrials : 0.0;
+
+    // Rechenberg: grow above one success in five, shrink below. A generation without offspring leaves the scale alone.
+    auto adapt = [this](double scale, size_t trials, double success) {
+        if (!enabled || trials == 0) return scale;
+        scale = (success > 0.2) ? scale * factor : scale / factor;
+        return min(maxScale, max(minScale, scale));
+    };
+    last.stepScale = adapt(last.stepScale, mutationTrials, last.mutationSuccess);
+    last.spreadScale = adapt(last.spreadScale, crossoverTrials, last.crossoverSuccess);
+
+    mutationTrials = mutationSuccesses = 0;
+    crossoverTrials = crossoverSuccesses = 0;
+    return last;
+}
@@ -0,0 +1,65 @@
+#ifndef OPERATORADAPTATION_H
+#define OPERATORADAPTATION_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <cstddef>
+
+/**
+ * @struct AdaptationStep
+ * @brief State of the OperatorAdaptation after one generation, one point of the adaptation trace.
+ */
+
+struct AdaptationStep {
+    int generation = 0;
+    int island = 0;                 // Lineage of the island that adapted, 0 for the single population and the steady-state GA
+    double stepScale = 1.0;         // Multiplier of the mutation sigmas used by the next generation
+    double spreadScale = 1.0;       // Multiplier of the blend crossover spread used by the next generation
+    double mutationSuccess = 0.0;   // Share of the mutated rows fitter than their parent
+    double crossoverSuccess = 0.0;  // Share of the children fitter than their best parent
+};
+
+/**
+ * @class OperatorAdaptation
+ * @brief 1/5th success rule controller of the GA mutation steps and crossover spread.
+ *
+ * The generation counts how many mutated rows beat their parent and how many children beat
+ * their best parent. After the generation each scale is multiplied by AdaptationFactor if more
+ * than one fifth of its offspring succeeded and divided by it otherwise, so steps grow while the
+ * search makes progress and shrink around an optimum. The state only depends on the solved
+ * fitness, a seeded run adapts the same way every time. Disabled, both scales stay at 1.
+ */
+
+class OperatorAdaptation {
+public:
+    explicit OperatorAdaptation(const OptimizationConfig& opt);
+
+    void recordMutations(size_t trials, size_t successes);      //!< Adds mutated rows of the current generation.
+    void recordCrossovers(size_t trials, size_t successes);     //!< Adds children of the current generation.
+
+    /**
+     * @brief Applies the 1/5th rule to the offspring recorded since the last call.
+     * @param generation The generation that was just bred.
+     * @return The new scales and the success rates they were computed from.
+     */
+    AdaptationStep endGeneration(int generation);
+
+    double stepScale() const { return last.stepScale; }
+    double spreadScale() const { return last.spreadScale; }
+    const AdaptationStep& lastStep() const { return last; }
+
+private:
+    bool enabled;
+    double factor;              //!< Multiplier applied at every generation
+    double minScale;
+    double maxScale;
+
+    size_t mutationTrials = 0;
+    size_t mutationSuccesses = 0;
+    size_t crossoverTrials = 0;
+    size_t crossoverSuccesses = 0;
+    AdaptationStep last;
+};
+
+#endif
@@ -0,0 +1,285 @@
+#include "src/Model/optimizer_engine.h"
+#include "src/Model/genetic_algorithm.h"
+#include "src/Model/brent_optimizer.h"
+#include "src/Model/task_scheduler.h"
+#include "src/Model/stagnation_monitor.h"
+#include "src/Model/cmaes_optimizer.h"
+#include "src/Model/de_optimizer.h"
+#include "src/Model/config_hash.h"
+#include "src/Model/result_store.h"
+
+#include "src/Controller/input_manager.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace std;
+
+
+OptimizerEngine::OptimizerEngine(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN)
+        : veh(vehicle), opt(optIN), sol(solIN), progress(optIN.ProgressRate) {
+        noSolution = false;
+        if (opt.Threads > 0) {
+            ownScheduler = make_unique<TaskScheduler>(opt.Threads);
+            scheduler = ownScheduler.get();
+        } else {
+            scheduler = &TaskScheduler::instance();
+        }
+    }
+
+OptimizerEngine::~OptimizerEngine() {}
+
+OptimizerEngine* OptimizerEngine::create(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN) {
+    switch (optIN.engine) {
+    case OptimizerType::Brent:
+        return new BrentOptimizer(vehicle, optIN, solIN);
+    case OptimizerType::CMAES:
+        return new CmaesOptimizer(vehicle, optIN, solIN);
+    case OptimizerType::DifferentialEvolution:
+        return new DifferentialEvolution(vehicle, optIN, solIN);
+    case OptimizerType::Genetic:
+    default:
+        return new GeneticAlgorithm(vehicle, optIN, solIN);
+    }
+}
+
+void OptimizerEngine::setResultStore(shared_ptr<ResultStore> store) {
+    resultStore = std::move(store);
+}
+
+bool OptimizerEngine::reproducible() const {
+    return opt.Seed != 0 && opt.TimeBudget <= 0.0;
+}
+
+bool OptimizerEngine::lookupStoredResult(StoredResult& result) {
+    storePending = false;
+    if (!resultStore || !reproducible()) return false;
+
+    storeKey = configurationKey(veh, sol, opt);
+    if (resultStore->lookup(storeKey, result)) return true;
+    storePending = true;
+    return false;
+}
+
+void OptimizerEngine::replay(const StoredResult& result) {
+    bestIndividual = result.best;
+    emit optimizationFinished(bestIndividual);
+    emit progressChanged(100);
+    // The stored summary has no telemetry, this replay measured nothing worth reporting
+    QString telemetry = "Run Telemetry:\n==============\nNone, the result was taken from the store\n==============\n\n";
+    emit summaryReady(result.summary + telemetry + storeReport("Taken from the store, nothing was solved"));
+    emit finished();
+}
+
+QString OptimizerEngine::storeResult() {
+    if (!storePending) return QString();
+    storePending = false;
+
+    // A stopped run is not the result of its configuration
+    if (stopRequested()) return storeReport("Not stored, the run was stopped");
+    if (noSolution) return storeReport("Not stored, no solution was found");
+    // Timings and worker load belong to this run, a replay must not present them as its own
+    StoredResult result{bestIndividual, generateSummary(bestIndividual, false)};
+    return storeReport(resultStore->store(storeKey, result) ? "Stored" : "Not stored, the store can not be written");
+}
+
+QString OptimizerEngine::storeReport(const QString& outcome) const {
+    QString report = "Result Store:\n";
+    report += "=============\n";
+    report += QString("Result: %1\n").arg(outcome);
+    report += QString("Configuration Key: %1\n").arg(storeKey, 16, 16, QChar('0'));
+    report += resultStore->report();
+    report += "=============\n\n";
+    return report;
+}
+
+QString OptimizerEngine::engineReport() const {
+    return QString();
+}
+
+QString OptimizerEngine::telemetryReport() const {
+    return loadBalanceReport(*scheduler);
+}
+
+void OptimizerEngine::publishProgress() {
+    ProgressInfo info;
+    if (progress.poll(info)) {
+        emit progressChanged(info.percent);
+        emit progressUpdated(info);
+    }
+}
+
+uint64_t OptimizerEngine::drawSeed() const {
+    if (opt.Seed != 0) return opt.Seed;
+    random_device randomDevice;
+    return (static_cast<uint64_t>(randomDevice()) << 32) | randomDevice();
+}
+
+Individual OptimizerEngine::decodeGenome(const double* unit, const Individual& velocity) const {
+    auto scale = [unit](int d, double lower, double upper) { return lower + clamp(unit[d], 0.0, 1.0) * (upper - lower); };
+    Individual ind;
+    ind.delta = scale(0, opt.minDelta, opt.maxDelta);
+    ind.defineGuesses(scale(1, opt.minAlphaf, opt.maxAlphaf), scale(2, opt.minAlphar, opt.maxAlphar),
+                      scale(3, opt.minKappaf, opt.maxKappaf), scale(4, opt.minKappar, opt.maxKappar),
+                      velocity.V_guess, velocity.Vx_guess, velocity.Vy_guess);
+    return ind;
+}
+
+void OptimizerEngine::solveBatch(vector<Individual>& batch) {
+    // Every task only touches its own Individual, veh, sol and opt are read-only
+    TaskGroup group(*scheduler);
+    for (Individual& ind : batch) {
+        Individual* target = &ind;
+        group.run([this, target]() {
+            if (stopRequested()) return;
+            solveMultiStart(*target, veh, sol, opt, opt.MultiStarts, [this]() { return stopRequested(); });
+            bool ok = target->converged && target->fitness > 0;
+            if (!ok) {
+                target->fitness = 0.0;
+            }
+            progress.recordSolve(ok);
+            progress.recordBest(target->fitness);
+            progress.advance();
+            publishProgress();
+        });
+    }
+    group.wait();
+}
+
+QString OptimizerEngine::stoppingReport(const StagnationMonitor& monitor) const {
+    QString report = QString("Generations Run: %1 of %2\n").arg(monitor.generation()).arg(opt.GenNum);
+    switch (monitor.reason()) {
+    case StopReason::Stagnation:
+        report += QString("Stopping Reason: best fitness improved less than %1 % in %2 generations\n")
+                      .arg(100.0 * opt.MinImprovement).arg(monitor.generationsWithoutImprovement());
+        break;
+    case StopReason::FitnessConverged:
+        report += QString("Stopping Reason: population fitness deviation %1 m/s below %2 m/s\n")
+                      .arg(monitor.fitnessStd()).arg(opt.MinFitnessStd);
+        break;
+    case StopReason::DeltaConverged:
+        report += QString("Stopping Reason: delta spread %1 degrees below %2 degrees\n")
+                      .arg(radToDegree(monitor.deltaSpread())).arg(radToDegree(opt.MinDeltaSpread));
+        break;
+    case StopReason::GenerationLimit:
+    default:
+        report += "Stopping Reason: generation limit reached\n";
+        break;
+    }
+    return report;
+}
+
+QString OptimizerEngine::stopReport() const {
+    if (cancellation->userRequested()) {
+        return "Run Stopped: by the user, best result so far\n";
+    }
+    if (cancellation->budgetExpired()) {
+        return QString("Run Stopped: time budget of %1 s expired, best result so far\n").arg(cancellation->budget());
+    }
+    return QString();
+}
+
+QString OptimizerEngine::loadBalanceReport(const TaskScheduler& scheduler) {
+    QString report;
+    double busy = 0.0, idle = 0.0;
+    size_t stolen = 0;
+    vector<WorkerStats> workers = scheduler.stats();
+
+    report += "Worker Load (busy / idle):\n";
+    for (size_t i = 0; i < workers.size(); i++) {
+        report += QString("  Worker %1: %2 s / %3 s, %4 tasks (%5 stolen)\n").arg(i).arg(workers[i].busySeconds, 0, 'f', 2)
+                      .arg(workers[i].idleSeconds, 0, 'f', 2).arg(workers[i].tasksRun).arg(workers[i].tasksStolen);
+        busy += workers[i].busySeconds;
+        idle += workers[i].idleSeconds;
+        stolen += workers[i].tasksStolen;
+    }
+    if (busy + idle > 0.0) {
+        report += QString("Worker Utilization: %1 %\n").arg(100.0 * busy / (busy + idle), 0, 'f', 1);
+    }
+    report += QString("Stolen Tasks: %1\n").arg(stolen);
+    return report;
+}
+
+QString OptimizerEngine::generateSummary(const Individual& best, bool telemetry){
+    QString summary;
+    // Handle the case where no solution could be found.
+    if (noSolution) {
+        if (stopRequested()) {
+            return stopReport() + "The run was stopped before any solution was found.\n\n";
+        }
+        summary = "The solver failed to find solutions for the given turn radius. Please try increasing the maximum number of iterations allowed or changing the vehicle parameters.\n\n";
+        return summary;
+    }
+
+    // Builds the detailed summary for Results tab in GUI
+    summary += "======================\n";
+    summary += "FINAL OPTIMIZED RESULT\n";
+    summary += "======================\n";
+    summary += QString("Max Velocity: %1 m/s\n").arg(best.fitness);
+    summary += QString("Max Vx: %1 m/s\n").arg(best.Vx);
+    summary += QString("Max Vy: %1 m/s\n").arg(best.Vy);
+    summary += QString("Yaw Velocity: %1 degrees\n").arg(radToDegree(best.r));
+    summary += QString("Max acc: %1 m/s^2\n\n").arg(best.ay);
+    summary += QString("Optimized Delta: %1 degrees\n").arg(radToDegree(best.delta));
+    summary += QString("Optimized Front Lateral Tire Force: %1 N\n").arg(best.MF_Fy_F);
+    summary += QString("Optimized Rear Lateral Tire Force: %1 N\n").arg(best.MF_Fy_R);
+    summary += QString("Optimized Front Longitudinal Tire Force: %1 N\n").arg(best.MF_Fx_F);
+    summary += QString("Optimized Rear Longitudinal Tire Force: %1 N\n\n").arg(best.MF_Fx_R);
+    summary += QString("Load Distribution on the front tire: %1 N\n").arg(best.Fz_F);
+    summary += QString("Load Distribution on the rear tire: %1 N\n\n").arg(best.Fz_R);
+    summary += QString("Front Slip Angle: %1 degree\n").arg(radToDegree(best.alpha_F));
+    summary += QString("Rear Slip Angle: %1 degree\n").arg(radToDegree(best.alpha_R));
+    summary += QString("Front Slip Ratio: %1 [-]\n").arg(best.kappa_F);
+    summary += QString("Rear Slip Ratio: %1 [-]\n\n").arg(best.kappa_R);
+    summary += "========================\n\n";
+
+    summary += "Car Parameters:\n";
+    summary += "===============\n";
+    summary += QString("Turn Radius: %1 m\n").arg(veh.R);
+    summary += QString("CG to Front Axle: %1 m\n").arg(veh.a);
+    summary += QString("CG to Rear Axle: %1 m\n").arg(veh.b);
+    summary += QString("Vehicle Mass: %1 kg\n").arg(veh.m);
+    summary += "===============\n\n";
+
+    summary += "Solver Parameters:\n";
+    summary += "==================\n";
+    summary += QString("Max Iterations: %1\n").arg(sol.maxIter);
+    summary += QString("Equations Formulation: %1\n").arg(sol.formulation == SolverFormulation::Reduced ? "Reduced (4 unknowns)" : "Full (7 unknowns)");
+    summary += QString("Residual Scaling: %1\n").arg(sol.adaptiveScaling ? "Adaptive" : "Legacy");
+    summary += "==================\n\n";
+
+    summary += "Optimization Parameters:\n";
+    summary += "========================\n";
+    summary += QString("Optimizer: %1\n").arg(engineName());
+    summary += engineReport();
+    summary += stopReport();
+    summary += QString("Delta Range: [%1 , %2] degrees\n\n").arg(radToDegree(opt.minDelta)).arg(radToDegree(opt.maxDelta));
+    summary += QString("Alpha_f Range: [%1 , %2] degrees\n").arg(radToDegree(opt.minAlphaf)).arg(radToDegree(opt.maxAlphar));
+    summary += QString("Alpha_r Range: [%1 , %2] degrees\n").arg(radToDegree(opt.minAlphar)).arg(radToDegree(opt.maxAlphar));
+    summary += QString("Kappa_f Range: [%1 , %2] [-]\n").arg(opt.minKappaf).arg(opt.maxKappar);
+    summary += QString("Kappa_r Range: [%1 , %2] [-]\n").arg(opt.minKappar).arg(opt.maxKappar);
+    summary += "========================\n\n";
+
+    summary += "\nSOLVER QUALITY\n";
+    summary += "===============\n";
+    summary += QString("Number of Iterations: %1\n").arg(best.stats.iterations);
+    summary += QString("Final Cost: %1\n").arg(best.stats.finalCost);
+    summary += QString("Termination: %1\n").arg(ceres::TerminationTypeToString(best.stats.termination));
+    summary += QString("Solve Time: %1 s\n").arg(best.stats.solveTime);
+    summary += QString("Jacobian Condition Number (%1): %2\n\n").arg(sol.formulation == SolverFormulation::Reduced ? "4x4" : "7x7")
+                                                                  .arg(jacobianConditionNumber(best, veh, sol));
+    summary += "Residuals:\n";
+    for (int i = 0; i < 7; i++) {
+        summary += QString("r[%1] = %2\n").arg(i).arg(best.residuals[i]);
+    }
+    summary += "===============\n\n\n";
+
+    if (telemetry) {
+        summary += "Run Telemetry:\n";
+        summary += "==============\n";
+        summary += telemetryReport();
+        summary += "==============\n\n";
+    }
+
+    return summary;
+}
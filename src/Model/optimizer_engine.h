@@ -0,0 +1,161 @@
+#ifndef OPTIMIZERENGINE_H
+#define OPTIMIZERENGINE_H
+#pragma once
+
+#include "src/model/eqn_solver.h"
+#include "src/controller/simulation_inputs.h"
+#include "src/model/progress_reporter.h"
+#include "src/model/cancellation_token.h"
+
+#include <QObject>
+#include <QString>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class TaskScheduler;
+class StagnationMonitor;
+class ResultStore;
+struct StoredResult;
+
+/**
+ * @class OptimizerEngine
+ * @brief Common interface for every optimizer that searches for the maximum cornering velocity.
+ *
+ * An engine receives the fixed Vehicle, the OptimizationConfig and the SolverConfig, runs on
+ * its own QThread and reports back through the same set of signals, so the GUI does not need
+ * to know which algorithm is running. The summary report is shared by all engines, each one
+ * only adds its own lines through engineReport() and telemetryReport().
+ */
+
+class OptimizerEngine : public QObject {
+    Q_OBJECT
+public:
+    bool noSolution = false;    //!< if it is not possible to find a solution with current configs, it returns true
+
+    Individual bestIndividual;  //!< Best Individual found by the engine is stored here
+
+    /**
+     * @brief Constructor for the OptimizerEngine base class.
+     * @param vehicle The Vehicle object with fixed parameters.
+     * @param optIN The OptimizationConfig with the optimizer settings.
+     * @param solIN The SolverConfig for the equation solver.
+     */
+    OptimizerEngine(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN);
+    virtual ~OptimizerEngine();
+
+    /**
+     * @brief Creates the engine selected at OptimizationConfig::engine.
+     * @return A new engine owned by the caller.
+     */
+    static OptimizerEngine* create(Vehicle vehicle, OptimizationConfig optIN, SolverConfig solIN);
+
+    /**
+     * @brief The main entry point to start the optimization.
+     */
+    virtual void run() = 0;
+
+    /**
+     * @brief Asks the running optimization to stop, it returns the best result found so far.
+     * Safe from any thread, e.g. the GUI while run() blocks the engine thread.
+     */
+    void requestStop() { cancellation->cancel(); }
+
+    //! Stop request of this engine, it can be kept after the engine is deleted.
+    std::shared_ptr<CancellationToken> cancellationToken() const { return cancellation; }
+
+    //! Telemetry of the last run: solver calls, converged ratio, best fitness and wall time.
+    ProgressInfo runStatistics() const { return progress.snapshot(); }
+
+    //! Every improvement of the best fitness during the last run, used to compare the engines.
+    std::vector<BestImprovement> bestHistory() const { return progress.history(); }
+
+    //! Shares the store of finished runs, consulted by lookupStoredResult() (null disables it).
+    void setResultStore(std::shared_ptr<ResultStore> store);
+
+    /**
+     * @brief Looks for a stored run of the same configuration, before run() is started.
+     * If the configuration is reproducible() and not stored yet, the run started afterwards stores its result.
+     * @param result Receives the stored run on a hit.
+     * @return true on a hit, the engine does not need to run: replay() publishes the stored result.
+     */
+    bool lookupStoredResult(StoredResult& result);
+
+    //! Emits the signals of a finished run with a stored result instead of running, from the thread of the engine.
+    void replay(const StoredResult& result);
+
+signals:
+    /**
+     * @brief Emitted periodically to update a progress bar in the GUI.
+     * @param value The current progress percentage (0-100).
+     */
+    void progressChanged(int value);
+
+    /**
+     * @brief Emitted together with progressChanged(), carrying the throughput telemetry of the run.
+     * @param info Solves per second, converged ratio, best fitness so far and ETA.
+     */
+    void progressUpdated(const ProgressInfo& info);
+
+    /**
+     * @brief Emitted when the entire optimization process has finished.
+     */
+    void finished();
+
+    /**
+     * @brief Emitted when the optimization is finished, carrying the best result.
+     * @param best The best Individual found by the engine.
+     */
+    void optimizationFinished(const Individual& best);
+
+    /**
+     * @brief Emitted when the final summary report is ready.
+     * @param summary A formatted QString containing the detailed results.
+     */
+    void summaryReady(QString summary);
+
+protected:
+    virtual QString engineName() const = 0;         //!< Name of the engine printed in the summary.
+    virtual QString engineReport() const;           //!< Engine specific lines of the "Optimization Parameters" section.
+    virtual QString telemetryReport() const;        //!< Measurements of this particular run (timings, worker load), the "Run Telemetry" section. The worker load by default.
+    QString generateSummary(const Individual& best, bool telemetry = true);    //!< Creates a formatted summary string of the results, optionally without the run telemetry.
+    static QString loadBalanceReport(const TaskScheduler& scheduler);   //!< Busy and idle time of every worker since the last TaskScheduler::resetStats().
+    void publishProgress();             //!< Emits the progress signals if the reporter says an update is due, safe from any thread.
+    bool stopRequested() const { return cancellation->cancelled(); }    //!< True once the user stopped the run or the TimeBudget expired.
+    QString stopReport() const;         //!< Why the run stopped early, empty if it was not stopped.
+    QString stoppingReport(const StagnationMonitor& monitor) const;     //!< Generations run and the criterion that ended them.
+    uint64_t drawSeed() const;          //!< OptimizationConfig::Seed, or a fresh random seed when it is 0.
+    virtual bool reproducible() const;  //!< True if the configuration alone fixes the result: a Seed is set and no TimeBudget.
+    QString storeResult();              //!< Stores the finished run, with its summary minus the telemetry, if it was looked up and completed; returns the result store lines of the summary.
+
+    /**
+     * @brief Maps a point of the unit hypercube to the genome of an Individual.
+     * @param unit delta, alpha_f, alpha_r, kappa_f and kappa_r guesses in [0, 1], scaled to the OptimizationConfig bounds.
+     * @param velocity Individual whose velocity guesses are copied, e.g. the best one so far.
+     */
+    Individual decodeGenome(const double* unit, const Individual& velocity) const;
+
+    /**
+     * @brief Solves a batch of Individuals in parallel on the scheduler, each one from OptimizationConfig::MultiStarts guesses.
+     * Feeds the progress reporter and stops solving when the run is cancelled, non-converged Individuals keep zero fitness.
+     */
+    void solveBatch(std::vector<Individual>& batch);
+
+    Vehicle veh;                            //!< The vehicle's fixed physical parameters.
+    OptimizationConfig opt;                 //!< Configuration for the optimization process.
+    SolverConfig sol;                       //!< Configuration to use in the equation solver.
+    ProgressReporter progress;              //!< Progress of the running optimization, fed by every worker.
+    std::shared_ptr<CancellationToken> cancellation = std::make_shared<CancellationToken>();   //!< Stop request and time budget, started by run().
+    std::unique_ptr<TaskScheduler> ownScheduler;    //!< Private workers, only created when OptimizationConfig::Threads is set
+    TaskScheduler* scheduler;               //!< Workers that solve the batches of Individuals, the shared scheduler by default
+
+private:
+    QString storeReport(const QString& outcome) const;  //!< Result store lines of the summary.
+
+    std::shared_ptr<ResultStore> resultStore;   //!< Finished runs, null disables the lookup
+    uint64_t storeKey = 0;                  //!< configurationKey() of the run, set by lookupStoredResult()
+    bool storePending = false;              //!< True if the result of this run goes to the store
+};
+
+#endif
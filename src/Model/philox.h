@@ -0,0 +1,95 @@
+#ifndef PHILOX_H
+#define PHILOX_H
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/*
+    philox provides counter-based random streams: every number is a pure
+    function of (seed, stream coordinates, draw index), so the optimizers
+    get the same random decisions no matter which thread makes them or in
+    which order.
+*/
+
+/**
+ * @brief One Philox4x32-10 block: encrypts a 128-bit counter with a 64-bit key.
+ * @param counter The four counter words.
+ * @param key The two key words.
+ * @return Four pseudo-random 32-bit words.
+ */
+inline std::array<uint32_t, 4> philox4x32(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+    const uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+    const uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+
+    for (int round = 0; round < 10; round++) {
+        uint64_t p0 = static_cast<uint64_t>(M0) * counter[0];
+        uint64_t p1 = static_cast<uint64_t>(M1) * counter[2];
+        counter = {static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(p1),
+                   static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(p0)};
+        key[0] += W0;
+        key[1] += W1;
+    }
+    return counter;
+}
+
+/**
+ * @class CounterRng
+ * @brief Random stream identified by (seed, lineage, generation, individual, gene).
+ *
+ * Two streams with different coordinates are independent, the same coordinates always give
+ * the same numbers. The lineage separates populations that evolve side by side (e.g. islands),
+ * the gene coordinate also names other random decisions (parent selection, migration, ...).
+ * It satisfies UniformRandomBitGenerator, but uniform() and normal() are preferred: they do
+ * not depend on the standard library implementation, so results are bit-identical everywhere.
+ */
+
+class CounterRng {
+public:
+    using result_type = uint32_t;
+
+    CounterRng(uint64_t seed, uint32_t lineage, uint32_t generation, uint32_t individual, uint32_t gene)
+        : key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)},
+          counter{individual, (gene & 0xFFFFu) | (lineage << 16), generation, 0} {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+    //! Next 32 random bits.
+    result_type operator()() {
+        if (used == 4) {
+            block = philox4x32(counter, key);
+            counter[3]++;
+            used = 0;
+        }
+        return block[used++];
+    }
+
+    //! Uniform double in [0, 1) with 53 random bits.
+    double uniform() {
+        uint64_t a = (*this)() >> 5, b = (*this)() >> 6;
+        return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+    }
+
+    //! Uniform double in [lower, upper).
+    double uniform(double lower, double upper) { return lower + uniform() * (upper - lower); }
+
+    //! Standard normal number (Box-Muller).
+    double normal() {
+        double u1 = 1.0 - uniform();    // (0, 1], so the logarithm is finite
+        double u2 = uniform();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+
+    //! Uniform integer in [0, n).
+    uint32_t index(uint32_t n) { return static_cast<uint32_t>((static_cast<uint64_t>((*this)()) * n) >> 32); }
+
+private:
+    std::array<uint32_t, 2> key;
+    std::array<uint32_t, 4> counter;
+    std::array<uint32_t, 4> block{};
+    int used = 4;
+};
+
+#endif
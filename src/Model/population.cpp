@@ -0,0 +1,76 @@
+#include "src/Model/population.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+
+void Population::resize(size_t n) {
+    for (auto& g : genes_) g.resize(n);
+    fitness_.resize(n);
+    converged_.resize(n);
+}
+
+void Population::reserve(size_t n) {
+    for (auto& g : genes_) g.reserve(n);
+    fitness_.reserve(n);
+    converged_.reserve(n);
+}
+
+void Population::clear() {
+    for (auto& g : genes_) g.clear();
+    fitness_.clear();
+    converged_.clear();
+}
+
+void Population::push_back(const Individual& ind) {
+    resize(size() + 1);
+    set(size() - 1, ind);
+}
+
+Individual Population::individual(size_t row) const {
+    Individual ind;
+    ind.delta = gene(Gene::Delta)[row];
+    ind.defineGuesses(gene(Gene::AlphaF)[row], gene(Gene::AlphaR)[row], gene(Gene::KappaF)[row], gene(Gene::KappaR)[row],
+                      gene(Gene::V)[row], gene(Gene::Vx)[row], gene(Gene::Vy)[row]);
+    ind.fitness = fitness_[row];
+    ind.converged = converged_[row] != 0;
+    return ind;
+}
+
+void Population::set(size_t row, const Individual& ind) {
+    gene(Gene::Delta)[row] = ind.delta;
+    gene(Gene::AlphaF)[row] = ind.alpha_F_guess;
+    gene(Gene::AlphaR)[row] = ind.alpha_R_guess;
+    gene(Gene::KappaF)[row] = ind.kappa_F_guess;
+    gene(Gene::KappaR)[row] = ind.kappa_R_guess;
+    gene(Gene::V)[row] = ind.V_guess;
+    gene(Gene::Vx)[row] = ind.Vx_guess;
+    gene(Gene::Vy)[row] = ind.Vy_guess;
+    fitness_[row] = ind.fitness;
+    converged_[row] = ind.converged ? 1 : 0;
+}
+
+void Population::copyRow(size_t to, const Population& from, size_t fromRow) {
+    for (size_t g = 0; g < genes_.size(); g++) {
+        genes_[g][to] = from.genes_[g][fromRow];
+    }
+    fitness_[to] = from.fitness_[fromRow];
+    converged_[to] = from.converged_[fromRow];
+}
+
+void Population::argsortByFitness(vector<size_t>& order) const {
+    order.resize(size());
+    iota(order.begin(), order.end(), size_t(0));
+    // std::sort does not allocate, the index tie-break keeps the order deterministic
+    const double* fit = fitness_.data();
+    sort(order.begin(), order.end(), [fit](size_t a, size_t b) {
+        return fit[a] > fit[b] || (fit[a] == fit[b] && a < b);
+    });
+}
+
+void Population::swap(Population& other) {
+    genes_.swap(other.genes_);
+    fitness_.swap(other.fitness_);
+    converged_.swap(other.converged_);
+}
@@ -0,0 +1,80 @@
+#ifndef POPULATION_H
+#define POPULATION_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <array>
+#include <vector>
+
+/**
+ * @enum Gene
+ * @brief The genes of an Individual handled by the genetic operators: delta and the solver initial guesses.
+ */
+
+enum class Gene {
+    Delta,
+    AlphaF,
+    AlphaR,
+    KappaF,
+    KappaR,
+    V,
+    Vx,
+    Vy,
+    Count
+};
+
+/**
+ * @class Population
+ * @brief Structure-of-arrays storage of the GA population.
+ *
+ * Every gene, the fitness and the convergence flag live in their own contiguous array, so
+ * sorting by fitness only touches the fitness array and the genetic operators run as simple
+ * passes over the gene arrays. The full Individual (forces, slips, residuals) is not stored,
+ * individual() materializes the genes of one row and set() scatters a solved Individual back.
+ */
+
+class Population {
+public:
+    size_t size() const { return fitness_.size(); }
+    bool empty() const { return fitness_.empty(); }
+    void resize(size_t n);
+    void reserve(size_t n);
+    void clear();
+
+    //! Appends the genes, fitness and convergence flag of an Individual.
+    void push_back(const Individual& ind);
+
+    //! Contiguous array of one gene for every row.
+    double* gene(Gene g) { return genes_[static_cast<int>(g)].data(); }
+    const double* gene(Gene g) const { return genes_[static_cast<int>(g)].data(); }
+
+    double* fitness() { return fitness_.data(); }
+    const double* fitness() const { return fitness_.data(); }
+    unsigned char* converged() { return converged_.data(); }
+    const unsigned char* converged() const { return converged_.data(); }
+
+    //! Builds an Individual with the genes, fitness and convergence flag of a row.
+    Individual individual(size_t row) const;
+
+    //! Stores the genes, fitness and convergence flag of an Individual at a row.
+    void set(size_t row, const Individual& ind);
+
+    //! Copies one row of another (or the same) Population.
+    void copyRow(size_t to, const Population& from, size_t fromRow);
+
+    /**
+     * @brief Row indices ordered by fitness, highest first, ties by index.
+     * @param order Receives the indices, it is only reallocated if its capacity is too small.
+     */
+    void argsortByFitness(std::vector<size_t>& order) const;
+
+    void swap(Population& other);
+
+private:
+    std::array<std::vector<double>, static_cast<int>(Gene::Count)> genes_;
+    std::vector<double> fitness_;
+    std::vector<unsigned char> converged_;     // Not vector<bool>, so rows can be written from different threads
+};
+
+#endif
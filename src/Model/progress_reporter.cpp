@@ -0,0 +1,95 @@
+#include "src/Model/progress_reporter.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+    // Telemetry is refreshed at least this often even if the percentage does not move
+    const long long RefreshInterval = 1000000000LL;
+}
+
+ProgressReporter::ProgressReporter(double maxRate)
+    : minInterval(maxRate > 0.0 ? static_cast<long long>(1e9 / maxRate) : 0) {
+    timer.start();
+}
+
+void ProgressReporter::start(double step) {
+    stepPercent = step;
+    done = 0;
+    solves = 0;
+    converged = 0;
+    best = 0.0;
+    lastPercent = 0;
+    lastPublish = -minInterval;     // The first change is published at once
+    {
+        lock_guard<mutex> lock(historyMutex);
+        improvements.clear();
+    }
+    timer.start();
+}
+
+void ProgressReporter::recordSolve(bool success) {
+    solves.fetch_add(1, memory_order_relaxed);
+    if (success) {
+        converged.fetch_add(1, memory_order_relaxed);
+    }
+}
+
+void ProgressReporter::recordBest(double fitness) {
+    double previous = best.load(memory_order_relaxed);
+    while (fitness > previous) {
+        if (best.compare_exchange_weak(previous, fitness, memory_order_relaxed)) {
+            // Improvements are rare, the lock does not slow down the workers
+            lock_guard<mutex> lock(historyMutex);
+            if (improvements.empty() || fitness > improvements.back().fitness) {
+                improvements.push_back({solves.load(memory_order_relaxed), timer.nsecsElapsed() * 1e-9, fitness});
+            }
+            return;
+        }
+    }
+}
+
+vector<BestImprovement> ProgressReporter::history() const {
+    lock_guard<mutex> lock(historyMutex);
+    return improvements;
+}
+
+ProgressInfo ProgressReporter::snapshot() const {
+    ProgressInfo info;
+    info.elapsedSeconds = timer.nsecsElapsed() * 1e-9;
+    double progress = min(done.load(memory_order_relaxed) * stepPercent.load(memory_order_relaxed), 99.0);
+    info.percent = max(static_cast<int>(progress), lastPercent.load(memory_order_relaxed));
+
+    size_t calls = solves.load(memory_order_relaxed);
+    info.solverCalls = calls;
+    if (info.elapsedSeconds > 0.0) {
+        info.solvesPerSecond = calls / info.elapsedSeconds;
+    }
+    if (calls > 0) {
+        info.convergedRatio = static_cast<double>(converged.load(memory_order_relaxed)) / calls;
+    }
+    info.bestFitness = best.load(memory_order_relaxed);
+
+    // Linear extrapolation of the elapsed time, the step already follows the predicted end of the run
+    if (progress > 0.0) {
+        info.etaSeconds = info.elapsedSeconds * (100.0 - progress) / progress;
+    }
+    return info;
+}
+
+bool ProgressReporter::poll(ProgressInfo& info) {
+    long long now = timer.nsecsElapsed();
+    long long last = lastPublish.load(memory_order_relaxed);
+    if (now - last < minInterval) return false;
+
+    info = snapshot();
+    if (info.percent <= lastPercent.load(memory_order_relaxed) && now - last < RefreshInterval) return false;
+
+    // Only the thread that moves the publication time forward publishes this snapshot
+    if (!lastPublish.compare_exchange_strong(last, now, memory_order_relaxed)) return false;
+    int previous = lastPercent.load(memory_order_relaxed);
+    while (info.percent > previous && !lastPercent.compare_exchange_weak(previous, info.percent, memory_order_relaxed)) {}
+    info.percent = max(info.percent, previous);
+    return true;
+}
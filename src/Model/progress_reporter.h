@@ -0,0 +1,105 @@
+#ifndef PROGRESSREPORTER_H
+#define PROGRESSREPORTER_H
+#pragma once
+
+#include <QElapsedTimer>
+#include <QMetaType>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * @struct ProgressInfo
+ * @brief Snapshot of a running optimization, published to the GUI by ProgressReporter.
+ */
+
+struct ProgressInfo {
+    int percent = 0;                //!< Progress bar value (0-99 while running)
+    double elapsedSeconds = 0.0;    //!< Wall time since the run started
+    double solvesPerSecond = 0.0;   //!< Solver calls per wall-clock second
+    double convergedRatio = 0.0;    //!< Fraction of the solver calls that converged
+    double bestFitness = 0.0;       //!< Best velocity found so far [m/s]
+    double etaSeconds = -1.0;       //!< Expected time to the end, negative while unknown
+    size_t solverCalls = 0;         //!< Solver calls so far
+};
+
+/**
+ * @struct BestImprovement
+ * @brief Point where the best fitness of a run improved, used to measure the effort to reach a target.
+ */
+
+struct BestImprovement {
+    size_t solverCalls;             //!< Solver calls made when the improvement was recorded
+    double seconds;                 //!< Wall time of the improvement
+    double fitness;                 //!< New best fitness [m/s]
+};
+
+Q_DECLARE_METATYPE(ProgressInfo)
+
+/**
+ * @class ProgressReporter
+ * @brief Aggregates the progress of every worker and decides when it is worth publishing.
+ *
+ * Workers only touch atomic counters. poll() hands out a snapshot at most maxRate times per
+ * second, and only when the percentage changed or the telemetry of the last one is a second
+ * old, so a large population does not flood the GUI event loop with queued signals that do
+ * not move the progress bar. A single thread wins each publication.
+ */
+
+class ProgressReporter {
+public:
+    /**
+     * @brief Creates an idle reporter.
+     * @param maxRate Maximum number of publications per second (0 or negative publishes every change).
+     */
+    explicit ProgressReporter(double maxRate = 20.0);
+
+    /**
+     * @brief Resets the counters and starts the clock of a new run.
+     * @param step Percentage added by every unit of work.
+     */
+    void start(double step);
+
+    //! Changes the percentage of a unit of work, e.g. when the run is predicted to end earlier.
+    void setStep(double step) { stepPercent = step; }
+
+    //! Adds finished units of work, safe from any thread.
+    void advance(size_t units = 1) { done.fetch_add(units, std::memory_order_relaxed); }
+
+    //! Counts a solver call, safe from any thread.
+    void recordSolve(bool converged);
+
+    //! Updates the best fitness so far, safe from any thread.
+    void recordBest(double fitness);
+
+    /**
+     * @brief Takes a snapshot if a publication is due.
+     * @param info Receives the snapshot.
+     * @return true if the caller must publish it.
+     */
+    bool poll(ProgressInfo& info);
+
+    //! Current state, regardless of the rate limit.
+    ProgressInfo snapshot() const;
+
+    //! Every improvement of the best fitness since start(), in increasing fitness.
+    std::vector<BestImprovement> history() const;
+
+private:
+    long long minInterval;                      //!< Minimum time between two publications [ns]
+    QElapsedTimer timer;
+    std::atomic<double> stepPercent{0.0};
+    std::atomic<size_t> done{0};
+    std::atomic<size_t> solves{0};
+    std::atomic<size_t> converged{0};
+    std::atomic<double> best{0.0};
+    std::atomic<int> lastPercent{0};            //!< Last published value, the progress bar never moves back
+    std::atomic<long long> lastPublish{0};      //!< Time of the last publication [ns]
+
+    mutable std::mutex historyMutex;            //!< Guards improvements, only taken when the best improves
+    std::vector<BestImprovement> improvements;
+};
+
+#endif
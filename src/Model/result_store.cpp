@@ -0,0 +1,195 @@
+#include "src/Model/result_store.h"
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <type_traits>
+
+using namespace std;
+
+namespace {
+    const quint32 Magic = 0x424d5253;      // "BMRS"
+    const quint32 Version = 2;             // 2: the summaries are stored without the run telemetry
+    const char* Suffix = ".bmres";
+
+    // The Individual is stored as raw bytes, the header rejects files of a build with another layout
+    static_assert(is_trivially_copyable<Individual>::value, "Individual is stored as raw bytes");
+
+    qint64 now() {
+        return QDateTime::currentMSecsSinceEpoch();
+    }
+}
+
+ResultStore::ResultStore(const QString& directory, qint64 maxBytes)
+        : dir(directory), maxBytes(maxBytes) {
+    QDir().mkpath(dir);
+    scan();
+}
+
+QString ResultStore::defaultDirectory() {
+    QString shared = qEnvironmentVariable("BICYCLEMODEL_RESULT_STORE");
+    if (!shared.isEmpty()) return shared;
+    QString cache = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (cache.isEmpty()) cache = QDir(QDir::homePath()).filePath(".BicycleModel");
+    return QDir(cache).filePath("results");
+}
+
+QString ResultStore::pathFor(uint64_t key) const {
+    return QDir(dir).filePath(QString("%1%2").arg(key, 16, 16, QChar('0')).arg(Suffix));
+}
+
+void ResultStore::scan() {
+    lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    totalBytes = 0;
+    const QFileInfoList files = QDir(dir).entryInfoList(QStringList() << QString("*%1").arg(Suffix), QDir::Files);
+    for (const QFileInfo& info : files) {
+        bool ok;
+        uint64_t key = info.completeBaseName().toULongLong(&ok, 16);
+        if (!ok) continue;
+        index[key] = {info.size(), info.lastModified().toMSecsSinceEpoch()};
+        totalBytes += info.size();
+    }
+    evict(0);     // The cap may have been lowered since the last session
+}
+
+bool ResultStore::lookup(uint64_t key, StoredResult& result) {
+    lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end()) {
+        missCount++;
+        return false;
+    }
+
+    QFile file(pathFor(key));
+    bool valid = file.open(QIODevice::ReadOnly);
+    if (valid) {
+        QDataStream in(&file);
+        quint32 magic, version, individualSize;
+        quint64 storedKey;
+        in >> magic >> version >> individualSize >> storedKey;
+        valid = magic == Magic && version == Version && individualSize == sizeof(Individual) && storedKey == key;
+        if (valid) {
+            QByteArray summary;
+            int bytes = static_cast<int>(sizeof(Individual));
+            valid = in.readRawData(reinterpret_cast<char*>(&result.best), bytes) == bytes;
+            in >> summary;
+            valid = valid && in.status() == QDataStream::Ok;
+            result.summary = QString::fromUtf8(qUncompress(summary));
+        }
+        file.close();
+    }
+    if (!valid) {
+        remove(key);      // Truncated or written by another build, it would never be readable
+        missCount++;
+        return false;
+    }
+
+    // The modification time of the file keeps the recency for the next sessions
+    it->second.lastUse = now();
+    if (file.open(QIODevice::ReadWrite)) {
+        file.setFileTime(QDateTime::fromMSecsSinceEpoch(it->second.lastUse), QFileDevice::FileModificationTime);
+        file.close();   // No handle is kept open for the rest of the run, the entry may be evicted or cleared
+    }
+    hitCount++;
+    return true;
+}
+
+bool ResultStore::store(uint64_t key, const StoredResult& result) {
+    lock_guard<std::mutex> lock(mutex);
+    QString path = pathFor(key);
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) return false;
+
+    QDataStream out(&file);
+    out << Magic << Version << quint32(sizeof(Individual)) << quint64(key);
+    out.writeRawData(reinterpret_cast<const char*>(&result.best), static_cast<int>(sizeof(Individual)));
+    out << qCompress(result.summary.toUtf8());
+    if (out.status() != QDataStream::Ok) {
+        file.cancelWriting();
+        return false;
+    }
+    if (!file.commit()) return false;
+
+    auto it = index.find(key);
+    if (it != index.end()) totalBytes -= it->second.bytes;
+    Entry& entry = index[key];
+    entry.bytes = QFileInfo(path).size();
+    entry.lastUse = now();
+    totalBytes += entry.bytes;
+    storeCount++;
+    evict(key);
+    return true;
+}
+
+void ResultStore::clear() {
+    lock_guard<std::mutex> lock(mutex);
+    while (!index.empty()) {
+        remove(index.begin()->first);
+    }
+}
+
+void ResultStore::remove(uint64_t key) {
+    auto it = index.find(key);
+    if (it == index.end()) return;
+    QFile::remove(pathFor(key));
+    totalBytes -= it->second.bytes;
+    index.erase(it);
+}
+
+void ResultStore::evict(uint64_t keep) {
+    while (totalBytes > maxBytes && index.size() > 1) {
+        auto oldest = index.end();
+        for (auto it = index.begin(); it != index.end(); ++it) {
+            if (it->first != keep && (oldest == index.end() || it->second.lastUse < oldest->second.lastUse)) {
+                oldest = it;
+            }
+        }
+        if (oldest == index.end()) break;
+        remove(oldest->first);
+        evictionCount++;
+    }
+}
+
+size_t ResultStore::entries() const {
+    lock_guard<std::mutex> lock(mutex);
+    return index.size();
+}
+
+qint64 ResultStore::bytes() const {
+    lock_guard<std::mutex> lock(mutex);
+    return totalBytes;
+}
+
+size_t ResultStore::hits() const {
+    lock_guard<std::mutex> lock(mutex);
+    return hitCount;
+}
+
+size_t ResultStore::misses() const {
+    lock_guard<std::mutex> lock(mutex);
+    return missCount;
+}
+
+size_t ResultStore::evictions() const {
+    lock_guard<std::mutex> lock(mutex);
+    return evictionCount;
+}
+
+QString ResultStore::report() const {
+    lock_guard<std::mutex> lock(mutex);
+    size_t lookups = hitCount + missCount;
+    QString report;
+    report += QString("Result Store Hits: %1 of %2 lookups (%3 %)\n").arg(hitCount).arg(lookups)
+                  .arg(lookups > 0 ? 100.0 * hitCount / lookups : 0.0, 0, 'f', 1);
+    report += QString("Result Store Size: %1 runs, %2 of %3 kB (%4 stored, %5 evicted this session)\n")
+                  .arg(index.size()).arg(totalBytes / 1024.0, 0, 'f', 1).arg(maxBytes / 1024)
+                  .arg(storeCount).arg(evictionCount);
+    return report;
+}
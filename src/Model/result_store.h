@@ -0,0 +1,95 @@
+#ifndef RESULTSTORE_H
+#define RESULTSTORE_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <QString>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @struct StoredResult
+ * @brief What a finished run leaves in the ResultStore: its best Individual and its summary report.
+ */
+
+struct StoredResult {
+    Individual best;
+    QString summary;
+};
+
+/**
+ * @class ResultStore
+ * @brief Content-addressed store of finished runs on the local disk.
+ *
+ * A run is addressed by the configurationKey() of its vehicle, tires, SolverConfig and
+ * OptimizationConfig, so a configuration that was already optimized is answered from the disk
+ * instead of being solved again. Each entry is one small binary file named after its key; the
+ * last use of an entry is the modification time of its file, so the least recently used entries
+ * are evicted first when the store grows beyond its size cap, also across sessions. The store is
+ * shared between the GUI and the engine threads, every access goes through its mutex.
+ */
+
+class ResultStore {
+public:
+    static const qint64 DefaultMaxBytes = 16LL << 20;  //!< 16 MB, a few thousand runs
+
+    /**
+     * @brief Opens a store and indexes the entries already in its directory.
+     * @param directory Folder of the entries, created if missing.
+     * @param maxBytes Size cap, the least recently used entries are evicted beyond it.
+     */
+    explicit ResultStore(const QString& directory = defaultDirectory(), qint64 maxBytes = DefaultMaxBytes);
+
+    //! The BICYCLEMODEL_RESULT_STORE environment variable if set, e.g. a folder shared by a team, or the user cache folder.
+    static QString defaultDirectory();
+
+    /**
+     * @brief Looks for the result of a configuration, a hit makes it the most recently used entry.
+     * @param key configurationKey() of the run.
+     * @param result Receives the stored run on a hit.
+     * @return true on a hit. Unreadable entries (e.g. written by another build) count as misses and are removed.
+     */
+    bool lookup(uint64_t key, StoredResult& result);
+
+    //! Stores the result of a configuration, then evicts the least recently used entries beyond the size cap.
+    bool store(uint64_t key, const StoredResult& result);
+
+    //! Removes every entry from the disk, the counters are kept.
+    void clear();
+
+    QString directory() const { return dir; }
+    size_t entries() const;
+    qint64 bytes() const;
+    size_t hits() const;
+    size_t misses() const;
+    size_t evictions() const;
+
+    //! Hits, misses and size of the store, lines of the summary report.
+    QString report() const;
+
+private:
+    struct Entry {
+        qint64 bytes;           //!< Size of the file
+        qint64 lastUse;         //!< Milliseconds since the epoch of the last store or hit
+    };
+
+    QString pathFor(uint64_t key) const;
+    void scan();                //!< Rebuilds the index from the files of the directory.
+    void remove(uint64_t key);  //!< Deletes an entry and its file.
+    void evict(uint64_t keep);  //!< Removes the least recently used entries, except keep, until the store fits the cap.
+
+    mutable std::mutex mutex;
+    QString dir;
+    qint64 maxBytes;
+    std::unordered_map<uint64_t, Entry> index;
+    qint64 totalBytes = 0;
+    size_t hitCount = 0;
+    size_t missCount = 0;
+    size_t storeCount = 0;
+    size_t evictionCount = 0;
+};
+
+#endif
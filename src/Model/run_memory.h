@@ -0,0 +1,59 @@
+#ifndef RUNMEMORY_H
+#define RUNMEMORY_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+#include "src/Model/fitness_cache.h"
+#include "src/Model/config_hash.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class RunMemory
+ * @brief Final state of the last optimization run, kept by the SimulationContext between runs.
+ *
+ * The next run seeds its initial population with the best Individuals remembered here, re-solved
+ * under the new parameters, so a what-if change (e.g. a new mass) starts from the last optimum
+ * instead of a cold design. The fitness cache is only reused when the solver problem is the same.
+ * Like the CancellationToken it is shared between the GUI and the engine thread and outlives the
+ * engine, every access goes through its mutex.
+ */
+
+class RunMemory {
+public:
+    /**
+     * @struct Snapshot
+     * @brief What one run leaves behind.
+     */
+    struct Snapshot {
+        uint64_t problemKey = 0;                    // solverProblemKey() of the run
+        std::vector<Individual> population;         // Final population, best first
+        std::vector<FitnessCache::Entry> cache;     // Solver results of the run
+    };
+
+    //! The last run, null if there is none.
+    std::shared_ptr<const Snapshot> recall() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return last;
+    }
+
+    //! Replaces the remembered run.
+    void remember(std::shared_ptr<const Snapshot> snapshot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        last = std::move(snapshot);
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        last.reset();
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::shared_ptr<const Snapshot> last;
+};
+
+#endif
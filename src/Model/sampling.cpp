@@ -0,0 +1,84 @@
+#include "src/Model/sampling.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    // Joe-Kuo direction numbers of dimensions 2 to 8: degree s, coefficients a and initial m_k
+    struct DirectionNumbers {
+        int s;
+        uint32_t a;
+        uint32_t m[5];
+    };
+
+    const DirectionNumbers joeKuo[SobolSequence::MaxDimensions - 1] = {
+        {1, 0, {1}},
+        {2, 1, {1, 3}},
+        {3, 1, {1, 3, 1}},
+        {3, 2, {1, 1, 1}},
+        {4, 1, {1, 1, 3, 3}},
+        {4, 4, {1, 3, 5, 13}},
+        {5, 2, {1, 1, 5, 5, 17}},
+    };
+}
+
+SobolSequence::SobolSequence(int dimensions, CounterRng& rng) : dims(min(max(dimensions, 1), MaxDimensions)) {
+    // First dimension: van der Corput sequence in base 2
+    for (int k = 0; k < 32; k++) {
+        direction[0][k] = 1u << (31 - k);
+    }
+
+    for (int d = 1; d < dims; d++) {
+        const DirectionNumbers& dn = joeKuo[d - 1];
+        uint32_t* v = direction[d].data();
+        for (int k = 0; k < dn.s; k++) {
+            v[k] = dn.m[k] << (31 - k);
+        }
+        for (int k = dn.s; k < 32; k++) {
+            v[k] = v[k - dn.s] ^ (v[k - dn.s] >> dn.s);
+            for (int j = 1; j < dn.s; j++) {
+                if ((dn.a >> (dn.s - 1 - j)) & 1u) {
+                    v[k] ^= v[k - j];
+                }
+            }
+        }
+    }
+
+    for (int d = 0; d < dims; d++) {
+        state[d] = 0;
+        shift[d] = rng();
+    }
+}
+
+void SobolSequence::next(double* point) {
+    for (int d = 0; d < dims; d++) {
+        point[d] = (state[d] ^ shift[d]) * (1.0 / 4294967296.0);
+    }
+
+    // Gray-code update: flip the direction number of the lowest zero bit of the index
+    int c = 0;
+    for (uint32_t i = index; i & 1u; i >>= 1) c++;
+    for (int d = 0; d < dims; d++) {
+        state[d] ^= direction[d][min(c, 31)];
+    }
+    index++;
+}
+
+void latinHypercube(size_t count, int dimensions, CounterRng& rng, double* points) {
+    if (count == 0) return;
+
+    vector<size_t> strata(count);
+    for (int d = 0; d < dimensions; d++) {
+        // Fisher-Yates with the stream itself, std::shuffle differs between standard libraries
+        iota(strata.begin(), strata.end(), size_t(0));
+        for (size_t i = count - 1; i > 0; i--) {
+            swap(strata[i], strata[rng.index(static_cast<uint32_t>(i + 1))]);
+        }
+        for (size_t i = 0; i < count; i++) {
+            points[i * dimensions + d] = (strata[i] + rng.uniform()) / count;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef SAMPLING_H
+#define SAMPLING_H
+#pragma once
+
+#include "src/Model/philox.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*
+    sampling builds space-filling designs in the unit hypercube, used to
+    spread the initial population of the optimizers over (delta, guesses)
+*/
+
+/**
+ * @class SobolSequence
+ * @brief Sobol low-discrepancy sequence with up to 8 dimensions and a random digital shift.
+ * Direction numbers are the Joe-Kuo ones, points are generated in Gray-code order.
+ */
+
+class SobolSequence {
+public:
+    static constexpr int MaxDimensions = 8;
+
+    /**
+     * @brief Creates the sequence.
+     * @param dimensions Number of coordinates of each point (at most MaxDimensions).
+     * @param rng Stream used to draw the digital shift, so different seeds cover different points.
+     */
+    SobolSequence(int dimensions, CounterRng& rng);
+
+    //! Writes the next point, every coordinate in [0, 1).
+    void next(double* point);
+
+private:
+    int dims;
+    uint32_t index = 0;
+    std::array<std::array<uint32_t, 32>, MaxDimensions> direction;
+    std::array<uint32_t, MaxDimensions> state;
+    std::array<uint32_t, MaxDimensions> shift;
+};
+
+/**
+ * @brief Writes a Latin hypercube design: every coordinate takes exactly one value in each of the count strata.
+ * @param count Number of points.
+ * @param dimensions Number of coordinates of each point.
+ * @param rng Stream for the permutations and the jitter inside the strata.
+ * @param points Output, count * dimensions values in [0, 1), point by point.
+ */
+void latinHypercube(size_t count, int dimensions, CounterRng& rng, double* points);
+
+#endif
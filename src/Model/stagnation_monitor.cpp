@@ -0,0 +1,57 @@
+#include "src/Model/stagnation_monitor.h"
+
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+StagnationMonitor::StagnationMonitor(const OptimizationConfig& opt)
+    : window(max(opt.StagnationWindow, 0)), minImprovement(opt.MinImprovement),
+      minFitnessStd(opt.MinFitnessStd), minDeltaSpread(opt.MinDeltaSpread) {}
+
+bool StagnationMonitor::update(int generation, const double* fitness, const double* delta, size_t n) {
+    lastGeneration = generation;
+    if (n == 0) return false;
+
+    // Statistics of the population in a single pass over the arrays
+    double best = fitness[0], sum = 0.0, sumSq = 0.0;
+    double minD = delta[0], maxD = delta[0];
+    for (size_t i = 0; i < n; i++) {
+        best = max(best, fitness[i]);
+        sum += fitness[i];
+        sumSq += fitness[i] * fitness[i];
+        minD = min(minD, delta[i]);
+        maxD = max(maxD, delta[i]);
+    }
+    double mean = sum / n;
+    lastFitnessStd = sqrt(max(sumSq / n - mean * mean, 0.0));
+    lastDeltaSpread = maxD - minD;
+
+    // Only an improvement larger than minImprovement restarts the window
+    if (generation == 0 || best > referenceBest * (1.0 + minImprovement)) {
+        referenceBest = best;
+        improvementGeneration = generation;
+    }
+
+    if (generation == 0) return false;
+
+    if (window > 0 && generation - improvementGeneration >= window) {
+        stopReason = StopReason::Stagnation;
+        return true;
+    }
+    if (minFitnessStd > 0.0 && lastFitnessStd < minFitnessStd) {
+        stopReason = StopReason::FitnessConverged;
+        return true;
+    }
+    if (minDeltaSpread > 0.0 && lastDeltaSpread < minDeltaSpread) {
+        stopReason = StopReason::DeltaConverged;
+        return true;
+    }
+    return false;
+}
+
+int StagnationMonitor::estimatedEnd(int maxGenerations) const {
+    // While the best keeps improving the expected end moves forward with it
+    if (window <= 0) return maxGenerations;
+    return min(maxGenerations, max(improvementGeneration + window, lastGeneration + 1));
+}
@@ -0,0 +1,68 @@
+#ifndef STAGNATIONMONITOR_H
+#define STAGNATIONMONITOR_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+
+#include <cstddef>
+
+/**
+ * @enum StopReason
+ * @brief Why an evolving population stopped.
+ */
+
+enum class StopReason {
+    GenerationLimit,    // All the GenNum generations were run
+    Stagnation,         // The best fitness did not improve enough during StagnationWindow generations
+    FitnessConverged,   // The fitness standard deviation of the population fell below MinFitnessStd
+    DeltaConverged      // The delta spread of the population fell below MinDeltaSpread
+};
+
+/**
+ * @class StagnationMonitor
+ * @brief Decides when a GA population is stable enough to stop before GenNum generations.
+ *
+ * It receives the fitness and delta arrays after every generation and checks the criteria of
+ * OptimizationConfig: relative improvement of the best fitness over a window, the population
+ * fitness spread and the delta spread. It also predicts the generation where the run will stop
+ * from the improvement trend, which drives the progress bar.
+ */
+
+class StagnationMonitor {
+public:
+    explicit StagnationMonitor(const OptimizationConfig& opt);
+
+    /**
+     * @brief Adds the state of the population after a generation.
+     * @param generation Number of generations run so far (0 for the initial population).
+     * @param fitness Fitness of every Individual.
+     * @param delta Delta of every Individual.
+     * @param n Number of Individuals.
+     * @return true if one of the enabled criteria says the population has converged.
+     */
+    bool update(int generation, const double* fitness, const double* delta, size_t n);
+
+    //! Generation where the run is expected to stop, never later than maxGenerations.
+    int estimatedEnd(int maxGenerations) const;
+
+    StopReason reason() const { return stopReason; }
+    int generation() const { return lastGeneration; }
+    double fitnessStd() const { return lastFitnessStd; }
+    double deltaSpread() const { return lastDeltaSpread; }
+    int generationsWithoutImprovement() const { return lastGeneration - improvementGeneration; }
+
+private:
+    int window;                 //!< StagnationWindow, 0 disables the criterion
+    double minImprovement;      //!< Relative improvement that counts as progress
+    double minFitnessStd;       //!< 0 disables the criterion
+    double minDeltaSpread;      //!< 0 disables the criterion
+
+    double referenceBest = 0.0;     //!< Best fitness at the last significant improvement
+    int improvementGeneration = 0;  //!< Generation of the last significant improvement
+    int lastGeneration = 0;
+    double lastFitnessStd = 0.0;
+    double lastDeltaSpread = 0.0;
+    StopReason stopReason = StopReason::GenerationLimit;
+};
+
+#endif
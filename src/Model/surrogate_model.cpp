@@ -0,0 +1,140 @@
+#include "src/Model/surrogate_model.h"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace {
+    const size_t MinCenters = 2 * SurrogateModel::Dimensions;   // Converged points needed before the model is used
+    const double Ridge = 1e-3;          // Smoothing of the interpolant, the solver results are noisy near the convergence limit
+    const double PriorWeight = 1e-3;    // Far from every point the convergence probability falls back to 0.5
+}
+
+void SurrogateModel::reset(const OptimizationConfig& opt) {
+    lower = {opt.minDelta, opt.minAlphaf, opt.minAlphar, opt.minKappaf, opt.minKappar};
+    Point upper = {opt.maxDelta, opt.maxAlphaf, opt.maxAlphar, opt.maxKappaf, opt.maxKappar};
+    for (int d = 0; d < Dimensions; d++) {
+        range[d] = max(upper[d] - lower[d], 1e-12);
+    }
+    capacity = static_cast<size_t>(max(opt.SurrogatePoints, static_cast<int>(MinCenters)));
+    next = 0;
+    inputs.clear();
+    fitness.clear();
+    converged.clear();
+    centers.clear();
+    weights.clear();
+    mean = 0.0;
+}
+
+void SurrogateModel::encode(const Population& pop, size_t first, size_t count, vector<Point>& points) const {
+    const Gene genes[Dimensions] = {Gene::Delta, Gene::AlphaF, Gene::AlphaR, Gene::KappaF, Gene::KappaR};
+    points.resize(count);
+    for (int d = 0; d < Dimensions; d++) {
+        const double* x = pop.gene(genes[d]) + first;
+        for (size_t i = 0; i < count; i++) {
+            points[i][d] = (x[i] - lower[d]) / range[d];
+        }
+    }
+}
+
+void SurrogateModel::add(const vector<Point>& points, const double* solvedFitness, const unsigned char* solvedConverged) {
+    for (size_t i = 0; i < points.size(); i++) {
+        bool ok = solvedConverged[i] && solvedFitness[i] > 0;
+        if (inputs.size() < capacity) {
+            inputs.push_back(points[i]);
+            fitness.push_back(solvedFitness[i]);
+            converged.push_back(ok);
+        } else {
+            // Full: the oldest point is overwritten, the population has moved away from it
+            inputs[next] = points[i];
+            fitness[next] = solvedFitness[i];
+            converged[next] = ok;
+            next = (next + 1) % capacity;
+        }
+    }
+}
+
+void SurrogateModel::exportPoints(vector<Point>& points, vector<double>& solvedFitness, vector<unsigned char>& solvedConverged, size_t& ring) const {
+    points = inputs;
+    solvedFitness = fitness;
+    solvedConverged = converged;
+    ring = next;
+}
+
+bool SurrogateModel::importPoints(const vector<Point>& points, const vector<double>& solvedFitness, const vector<unsigned char>& solvedConverged, size_t ring) {
+    bool consistent = points.size() == solvedFitness.size() && points.size() == solvedConverged.size();
+    if (!consistent || points.size() > capacity || ring >= capacity) return false;
+
+    inputs = points;
+    fitness = solvedFitness;
+    converged = solvedConverged;
+    next = ring;
+    fit();      // The fitted interpolant is a pure function of the points
+    return true;
+}
+
+double SurrogateModel::kernel(const Point& a, const Point& b) const {
+    double dist2 = 0.0;
+    for (int d = 0; d < Dimensions; d++) {
+        double diff = a[d] - b[d];
+        dist2 += diff * diff;
+    }
+    return exp(-dist2 * inverseWidth);
+}
+
+void SurrogateModel::fit() {
+    centers.clear();
+    weights.clear();
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (converged[i]) centers.push_back(i);
+    }
+    if (centers.size() < MinCenters) return;
+
+    // Kernel width from the mean spacing of the points in the unit hypercube
+    double length = max(0.05, pow(static_cast<double>(inputs.size()), -1.0 / Dimensions));
+    inverseWidth = 1.0 / (2.0 * length * length);
+
+    size_t m = centers.size();
+    mean = 0.0;
+    for (size_t c : centers) mean += fitness[c];
+    mean /= m;
+
+    Eigen::MatrixXd K(m, m);
+    Eigen::VectorXd y(m);
+    for (size_t i = 0; i < m; i++) {
+        y(i) = fitness[centers[i]] - mean;
+        K(i, i) = 1.0 + Ridge;
+        for (size_t j = 0; j < i; j++) {
+            K(i, j) = K(j, i) = kernel(inputs[centers[i]], inputs[centers[j]]);
+        }
+    }
+    Eigen::VectorXd w = K.ldlt().solve(y);
+    if (!w.allFinite()) {
+        centers.clear();
+        return;
+    }
+    weights.assign(w.data(), w.data() + m);
+}
+
+bool SurrogateModel::ready() const {
+    return centers.size() >= MinCenters && weights.size() == centers.size();
+}
+
+void SurrogateModel::predict(const vector<Point>& points, double* score) const {
+    for (size_t p = 0; p < points.size(); p++) {
+        double f = mean;
+        for (size_t c = 0; c < centers.size(); c++) {
+            f += weights[c] * kernel(points[p], inputs[centers[c]]);
+        }
+        double hits = 0.5 * PriorWeight, total = PriorWeight;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            double k = kernel(points[p], inputs[i]);
+            hits += k * converged[i];
+            total += k;
+        }
+        score[p] = (hits / total) * max(f, 0.0);
+    }
+}
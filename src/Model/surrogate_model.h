@@ -0,0 +1,94 @@
+#ifndef SURROGATEMODEL_H
+#define SURROGATEMODEL_H
+#pragma once
+
+#include "src/controller/simulation_inputs.h"
+#include "src/Model/population.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class SurrogateModel
+ * @brief Cheap online model of the solver over (delta, guesses), used to pre-screen GA children.
+ *
+ * The inputs are delta and the four slip guesses, scaled to [0, 1] with the OptimizationConfig
+ * bounds. The fitness is a Gaussian radial basis function interpolant fitted on the converged
+ * points, the convergence probability is a kernel-weighted average of the converged flags of all
+ * the points. Only the latest capacity points are kept, so fit() costs at most capacity^3 / 3
+ * flops and a prediction capacity kernel evaluations, both negligible against a Ceres solve.
+ * The model is not thread-safe, every population owns its own one.
+ */
+
+class SurrogateModel {
+public:
+    static constexpr int Dimensions = 5;    //!< delta, alpha_f, alpha_r, kappa_f, kappa_r
+    using Point = std::array<double, Dimensions>;
+
+    /**
+     * @brief Forgets every point and takes the bounds and capacity of a new run.
+     * @param opt The OptimizationConfig with the gene bounds and SurrogatePoints.
+     */
+    void reset(const OptimizationConfig& opt);
+
+    //! Scaled inputs of a range of rows, count points.
+    void encode(const Population& pop, size_t first, size_t count, std::vector<Point>& points) const;
+
+    /**
+     * @brief Adds solved points, the oldest ones are dropped beyond the capacity.
+     * @param points Inputs of the points, as given by encode() before the solve.
+     * @param fitness Solved fitness of every point.
+     * @param converged Convergence flag of every point.
+     */
+    void add(const std::vector<Point>& points, const double* fitness, const unsigned char* converged);
+
+    //! Refits the interpolant to the current points.
+    void fit();
+
+    //! True when enough converged points were added for the predictions to mean something.
+    bool ready() const;
+
+    /**
+     * @brief Predicts the expected fitness of candidates: predicted fitness times convergence probability.
+     * @param points Inputs of the candidates.
+     * @param score Output, one value per candidate, higher is more promising.
+     */
+    void predict(const std::vector<Point>& points, double* score) const;
+
+    size_t size() const { return inputs.size(); }
+
+    /**
+     * @brief Copies the points and the ring position, for a checkpoint.
+     * @param points Inputs of the points, in storage order.
+     * @param solvedFitness Fitness of every point.
+     * @param solvedConverged Convergence flag of every point.
+     * @param ring Position of the next point to overwrite.
+     */
+    void exportPoints(std::vector<Point>& points, std::vector<double>& solvedFitness, std::vector<unsigned char>& solvedConverged, size_t& ring) const;
+
+    /**
+     * @brief Replaces the points with saved ones and refits, reset() must have set the bounds first.
+     * @return false if the points do not fit the capacity of the run, the model is then left unchanged.
+     */
+    bool importPoints(const std::vector<Point>& points, const std::vector<double>& solvedFitness, const std::vector<unsigned char>& solvedConverged, size_t ring);
+
+private:
+    double kernel(const Point& a, const Point& b) const;
+
+    Point lower{}, range{};                 //!< Gene bounds used to scale the inputs
+    size_t capacity = 256;
+    size_t next = 0;                        //!< Ring position of the next point once the model is full
+
+    std::vector<Point> inputs;
+    std::vector<double> fitness;
+    std::vector<unsigned char> converged;
+
+    // Fitted interpolant, over the converged points only
+    std::vector<size_t> centers;
+    std::vector<double> weights;
+    double mean = 0.0;                      //!< Mean converged fitness, the interpolant models the deviation from it
+    double inverseWidth = 1.0;              //!< 1 / (2 * length^2) of the Gaussian kernel
+};
+
+#endif
@@ -0,0 +1,226 @@
+#include "src/Model/task_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+namespace {
+    // Identifies the scheduler and the worker index of the calling thread
+    thread_local TaskScheduler* tlsScheduler = nullptr;
+    thread_local int tlsWorker = -1;
+
+    // Tasks running on the calling thread, nested ones run inside TaskGroup::wait() of an outer one
+    thread_local int tlsDepth = 0;
+    // Time the calling thread slept in TaskGroup::wait(), taken out of the busy time of its outer task
+    thread_local long long tlsSleptNs = 0;
+
+    long long nowNs() {
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+TaskScheduler::TaskScheduler(int threads) {
+    int count = (threads > 0) ? threads : static_cast<int>(thread::hardware_concurrency());
+    if (count <= 0) count = 1;
+
+    for (int i = 0; i < count; i++) {
+        workers_.push_back(make_unique<Worker>());
+    }
+    for (int i = 0; i < count; i++) {
+        threads_.emplace_back(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        lock_guard<mutex> lock(sleepMutex_);
+        stop_ = true;
+    }
+    wakeUp_.notify_all();
+    for (thread& t : threads_) {
+        t.join();
+    }
+}
+
+TaskScheduler& TaskScheduler::instance() {
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+TaskScheduler& TaskScheduler::current() {
+    return tlsScheduler ? *tlsScheduler : instance();
+}
+
+vector<WorkerStats> TaskScheduler::stats() const {
+    vector<WorkerStats> result(workers_.size());
+    for (size_t i = 0; i < workers_.size(); i++) {
+        result[i].busySeconds = workers_[i]->busyNs.load() * 1e-9;
+        result[i].idleSeconds = workers_[i]->idleNs.load() * 1e-9;
+        result[i].tasksRun = workers_[i]->tasksRun.load();
+        result[i].tasksStolen = workers_[i]->tasksStolen.load();
+    }
+    return result;
+}
+
+void TaskScheduler::resetStats() {
+    resetNs_ = nowNs();
+    for (auto& w : workers_) {
+        w->busyNs = 0;
+        w->idleNs = 0;
+        w->tasksRun = 0;
+        w->tasksStolen = 0;
+    }
+}
+
+void TaskScheduler::submit(Task task) {
+    if (tlsScheduler == this && tlsWorker >= 0) {
+        // Nested task: keep it on the own deque, it is the most likely to be hot in cache
+        Worker& w = *workers_[tlsWorker];
+        lock_guard<mutex> lock(w.mutex);
+        w.tasks.push_back(std::move(task));
+    } else {
+        lock_guard<mutex> lock(injectionMutex_);
+        injection_.push_back(std::move(task));
+    }
+    queued_++;
+    submitted_++;
+
+    // Lock so the notification can not be lost between the check and the wait of a worker
+    { lock_guard<mutex> lock(sleepMutex_); }
+    wakeUp_.notify_one();
+    if (waiting_.load() > 0) {
+        groupChanged_.notify_all();
+    }
+}
+
+bool TaskScheduler::takeTask(int self, Task& task, bool& stolen, const TaskGroup* only) {
+    stolen = false;
+    auto matches = [only](const Task& t) { return !only || t.group == only; };
+
+    // 1. Own deque, newest first
+    if (self >= 0) {
+        Worker& w = *workers_[self];
+        lock_guard<mutex> lock(w.mutex);
+        if (!w.tasks.empty()) {
+            task = std::move(w.tasks.back());
+            w.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // 2. Tasks submitted from outside the pool. A worker waiting on a group leaves them to the idle
+    // workers, a whole island or worker loop would otherwise run on top of the waiting task.
+    if (!only || self < 0) {
+        lock_guard<mutex> lock(injectionMutex_);
+        auto it = find_if(injection_.begin(), injection_.end(), matches);
+        if (it != injection_.end()) {
+            task = std::move(*it);
+            injection_.erase(it);
+            return true;
+        }
+    }
+
+    // 3. Steal the oldest task of another worker
+    int count = workerCount();
+    int start = (self >= 0) ? self + 1 : 0;
+    for (int k = 0; k < count; k++) {
+        int victim = (start + k) % count;
+        if (victim == self) continue;
+        Worker& w = *workers_[victim];
+        lock_guard<mutex> lock(w.mutex);
+        auto it = find_if(w.tasks.begin(), w.tasks.end(), matches);
+        if (it != w.tasks.end()) {
+            task = std::move(*it);
+            w.tasks.erase(it);
+            stolen = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TaskScheduler::runOne(int self, const TaskGroup* only) {
+    if (queued_.load() == 0) return false;
+
+    Task task;
+    bool stolen;
+    if (!takeTask(self, task, stolen, only)) return false;
+    queued_--;
+
+    // Threads helping from outside the pool act as part of it, so nested tasks find this scheduler
+    TaskScheduler* previous = tlsScheduler;
+    tlsScheduler = this;
+
+    // Only the outermost task is timed: it already contains the nested tasks it helped with,
+    // but not the time it slept waiting for them
+    int depth = tlsDepth++;
+    long long sleptBefore = tlsSleptNs;
+    long long start = nowNs();
+    task.fn();
+    tlsDepth--;
+    if (self >= 0) {
+        Worker& w = *workers_[self];
+        if (depth == 0) {
+            w.busyNs += max(0LL, nowNs() - max(start, resetNs_.load()) - (tlsSleptNs - sleptBefore));
+        }
+        w.tasksRun++;
+        if (stolen) w.tasksStolen++;
+    }
+
+    tlsScheduler = previous;
+
+    // The group may be destroyed as soon as its waiter sees 0, only the scheduler is touched afterwards
+    if (--task.group->pending_ == 0) {
+        { lock_guard<mutex> lock(sleepMutex_); }
+        groupChanged_.notify_all();
+    }
+    return true;
+}
+
+void TaskScheduler::workerLoop(int self) {
+    tlsScheduler = this;
+    tlsWorker = self;
+
+    while (!stop_) {
+        if (runOne(self)) continue;
+
+        // Nothing to do: sleep until a task is submitted
+        long long start = nowNs();
+        {
+            unique_lock<mutex> lock(sleepMutex_);
+            wakeUp_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+        }
+        // Time asleep before the last resetStats() does not belong to the current run
+        workers_[self]->idleNs += max(0LL, nowNs() - max(start, resetNs_.load()));
+    }
+}
+
+void TaskGroup::run(function<void()> task) {
+    pending_++;
+    scheduler_.submit(TaskScheduler::Task{std::move(task), this});
+}
+
+void TaskGroup::wait() {
+    int self = (tlsScheduler == &scheduler_) ? tlsWorker : -1;
+    while (pending_.load() > 0) {
+        // Help with the tasks of this group (and of the own deque), sleep until the group finishes or new work is queued
+        unsigned long long seen = scheduler_.submitted_.load();
+        if (scheduler_.runOne(self, this)) continue;
+
+        long long start = nowNs();
+        {
+            unique_lock<mutex> lock(scheduler_.sleepMutex_);
+            scheduler_.waiting_++;
+            scheduler_.groupChanged_.wait(lock, [this, seen] { return pending_.load() == 0 || scheduler_.submitted_.load() != seen; });
+            scheduler_.waiting_--;
+        }
+
+        // A worker asleep here is idle, even though it is inside a task
+        long long slept = nowNs() - start;
+        tlsSleptNs += slept;
+        if (self >= 0) {
+            scheduler_.workers_[self]->idleNs += max(0LL, nowNs() - max(start, scheduler_.resetNs_.load()));
+        }
+    }
+}
@@ -0,0 +1,142 @@
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+    task_scheduler runs the solver work of the optimizers (population
+    evaluation, multi-start solves, delta sweeps) on a pool of threads
+    with work stealing, so the very different cost of each solve does
+    not leave cores idle.
+*/
+
+class TaskGroup;
+
+/**
+ * @struct WorkerStats
+ * @brief Load balance counters of one worker thread of the TaskScheduler.
+ */
+
+struct WorkerStats {
+    double busySeconds = 0.0;       // Time spent running tasks
+    double idleSeconds = 0.0;       // Time spent sleeping without work
+    size_t tasksRun = 0;            // Number of tasks executed by the worker
+    size_t tasksStolen = 0;         // Number of those tasks taken from another worker's deque
+};
+
+/**
+ * @class TaskScheduler
+ * @brief A work-stealing thread pool.
+ *
+ * Every worker owns a deque of tasks. Tasks submitted from a worker go to the back of its own
+ * deque and are taken LIFO by it, tasks submitted from other threads go to a shared injection
+ * queue. A worker without work steals from the front of the other deques. Threads waiting on a
+ * TaskGroup execute the tasks of their own deque and of that group, and only sleep when there is
+ * none, so tasks can create and wait for nested tasks (e.g. a multi-start solve inside a population
+ * evaluation) without deadlocks. A waiting worker never picks up unrelated top-level work, such as
+ * another island, which would freeze the waiting task until it ends. Busy time is only counted for
+ * the outermost task of a worker, without the time it slept in a wait.
+ */
+
+class TaskScheduler {
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threads Number of workers, 0 uses all the hardware threads.
+     */
+    explicit TaskScheduler(int threads = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    //! The scheduler shared by the whole application.
+    static TaskScheduler& instance();
+
+    //! The scheduler whose task is running on the calling thread, or instance() outside of any task.
+    static TaskScheduler& current();
+
+    //! Number of worker threads.
+    int workerCount() const { return static_cast<int>(workers_.size()); }
+
+    //! Snapshot of the load balance counters of every worker.
+    std::vector<WorkerStats> stats() const;
+
+    //! Clears the load balance counters.
+    void resetStats();
+
+private:
+    friend class TaskGroup;
+
+    struct Task {
+        std::function<void()> fn;
+        TaskGroup* group;
+    };
+
+    struct Worker {
+        std::deque<Task> tasks;
+        std::mutex mutex;
+        std::atomic<long long> busyNs{0};
+        std::atomic<long long> idleNs{0};
+        std::atomic<size_t> tasksRun{0};
+        std::atomic<size_t> tasksStolen{0};
+    };
+
+    void submit(Task task);             //!< Queues a task on the calling worker's deque or on the injection queue.
+    bool runOne(int self, const TaskGroup* only = nullptr);     //!< Runs one pending task (of the own deque or of group only, if given), returns false if there was none.
+    bool takeTask(int self, Task& task, bool& stolen, const TaskGroup* only = nullptr);  //!< Pops a task from the own deque, the injection queue or a victim.
+    void workerLoop(int self);          //!< Main loop of each worker thread.
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+
+    std::deque<Task> injection_;        //!< Tasks submitted from threads that are not workers
+    std::mutex injectionMutex_;
+
+    std::atomic<int> queued_{0};        //!< Tasks waiting in any queue
+    std::atomic<unsigned long long> submitted_{0};  //!< Tasks submitted so far, a waiting TaskGroup wakes up when it changes
+    std::atomic<int> waiting_{0};       //!< Threads asleep in TaskGroup::wait()
+    std::atomic<long long> resetNs_{0}; //!< steady_clock time of the last resetStats(), in ns
+    std::atomic<bool> stop_{false};
+    std::mutex sleepMutex_;
+    std::condition_variable wakeUp_;    //!< Signalled when a task is queued, wakes the idle workers
+    std::condition_variable groupChanged_;  //!< Signalled when a task is queued or a TaskGroup finishes, wakes the waiting groups
+};
+
+/**
+ * @class TaskGroup
+ * @brief A set of tasks that can be waited for together.
+ * wait() runs pending tasks of the group while it is not finished and sleeps when there is
+ * nothing to run, the destructor waits too.
+ */
+
+class TaskGroup {
+public:
+    explicit TaskGroup(TaskScheduler& scheduler = TaskScheduler::current()) : scheduler_(scheduler) {}
+    ~TaskGroup() { wait(); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    //! Submits a task to the scheduler as part of this group.
+    void run(std::function<void()> task);
+
+    //! Returns when every task of the group has finished, helping the scheduler meanwhile.
+    void wait();
+
+private:
+    friend class TaskScheduler;
+
+    TaskScheduler& scheduler_;
+    std::atomic<int> pending_{0};
+};
+
+#endif
@@ -17,7 +17,10 @@
  */
 
 
+#include <QCoreApplication>
+#include <QDateTime>
 #include <QPixmap>
+#include <QStandardPaths>
 #include "main_window.h"
 #include "ui_mainwindow.h"
 #include "src/Controller/input_manager.h"
@@ -25,6 +28,7 @@
 #include "src/Controller/plot_tire_forces.h"
 #include "src/model/eqn_solver.h"
 #include "src/Model/genetic_algorithm.h"
+#include "src/Model/result_store.h"
 #include "src/Controller/tire_params_editor_dialog.h"
 #include "src/Model/tire_model.h"
 
@@ -55,6 +59,8 @@ MainWindow::MainWindow(QWidget *parent)
 
     ui->setupUi(this);
     adjustToScreenSize();  // Adjust to screen size
+    simCtx.runMemory = std::make_shared<RunMemory>();
+    simCtx.resultStore = std::make_shared<ResultStore>();
     setWindowTitle("Bicycle Model V2");
 
     // Setup of Images used in the interdface
@@ -95,8 +101,19 @@ void MainWindow::setDefaultValues(){
     ui->Eqn5TolInput->setText(QString::number(simCtx.sol.Tolerances[4], 'E', 0));
     ui->Eqn6TolInput->setText(QString::number(simCtx.sol.Tolerances[5], 'E', 0));
     ui->Eqn7TolInput->setText(QString::number(simCtx.sol.Tolerances[6], 'E', 0));
+    ui->formulationComboBox->clear();
+    ui->formulationComboBox->addItem("Full (7 unknowns)", static_cast<int>(SolverFormulation::Full));
+    ui->formulationComboBox->addItem("Reduced (4 unknowns)", static_cast<int>(SolverFormulation::Reduced));
+    ui->formulationComboBox->setCurrentIndex(ui->formulationComboBox->findData(static_cast<int>(simCtx.sol.formulation)));
     ui->genNumInput->setText(QString::number(simCtx.opt.GenNum));
     ui->PopSizeInput->setText(QString::number(simCtx.opt.PopSize));
+    ui->seedInput->setText(QString::number(simCtx.opt.Seed));
+    ui->optimizerComboBox->clear();
+    ui->optimizerComboBox->addItem("Genetic Algorithm", static_cast<int>(OptimizerType::Genetic));
+    ui->optimizerComboBox->addItem("Brent (delta only)", static_cast<int>(OptimizerType::Brent));
+    ui->optimizerComboBox->addItem("CMA-ES", static_cast<int>(OptimizerType::CMAES));
+    ui->optimizerComboBox->addItem("Differential Evolution", static_cast<int>(OptimizerType::DifferentialEvolution));
+    ui->optimizerComboBox->setCurrentIndex(ui->optimizerComboBox->findData(static_cast<int>(simCtx.opt.engine)));
     ui->minDeltaInput->setText(QString::number(std::round(radToDegree(simCtx.opt.minDelta))));
     ui->maxDeltaInput->setText(QString::number(std::round(radToDegree(simCtx.opt.maxDelta))));
     ui->minAlphafInput->setText(QString::number(std::round(radToDegree(simCtx.opt.minAlphaf))));
@@ -343,6 +360,11 @@ void MainWindow::on_Eqn6TolInput_editingFinished(){ InputManager::validateAndSto
 
 void MainWindow::on_Eqn7TolInput_editingFinished(){ InputManager::validateAndStorePosi(ui->Eqn7TolInput, simCtx.sol.Tolerances[6]);}
 
+void MainWindow::on_formulationComboBox_currentIndexChanged(int index){
+    if (index < 0) return;
+    simCtx.sol.formulation = static_cast<SolverFormulation>(ui->formulationComboBox->itemData(index).toInt());
+}
+
 //          OPTIMIZATION TAB
 // Actions that are triggered for each button 
 
@@ -350,6 +372,22 @@ void MainWindow::on_genNumInput_editingFinished(){ InputManager::validateAndStor
 
 void MainWindow::on_PopSizeInput_editingFinished(){ InputManager::validateAndStoreInt(ui->PopSizeInput, simCtx.opt.PopSize);}
 
+// 0 draws a new seed at every run, any other seed makes the run reproducible and lets the result store answer it
+void MainWindow::on_seedInput_editingFinished(){
+    bool ok;
+    unsigned long long seed = ui->seedInput->text().toULongLong(&ok);
+    if (ok) {
+        simCtx.opt.Seed = seed;
+    } else {
+        ui->seedInput->setText(QString::number(simCtx.opt.Seed));
+    }
+}
+
+void MainWindow::on_optimizerComboBox_currentIndexChanged(int index){
+    if (index < 0) return;
+    simCtx.opt.engine = static_cast<OptimizerType>(ui->optimizerComboBox->itemData(index).toInt());
+}
+
 void MainWindow::on_minDeltaInput_editingFinished(){ InputManager::validateAndStoreInRad(ui->minDeltaInput, simCtx.opt.minDelta);}
 
 void MainWindow::on_maxDeltaInput_editingFinished(){ InputManager::validateAndStoreInRad(ui->maxDeltaInput, simCtx.opt.maxDelta);}
@@ -387,21 +425,95 @@ void MainWindow::on_calculateButton_clicked()
     ui->resultsStatusLabel->setText("Optimization running...");
     ui->resultsProgressBar->setValue(0);
 
-    // Ask InputManager to run the GA and store it in ga
-    GeneticAlgorithm* ga = InputManager::startOptimization (simCtx.opt, simCtx.sol, simCtx.veh, ui->resultsProgressBar, ui->resultsStatusLabel);
-    
-    if (ga){
-        // Conecting Results Text Box generated by the GA to the Results Tab 
-        QObject::connect(ga, &GeneticAlgorithm::summaryReady, this, [=](const QString& summary){ 
+    // Ask InputManager to run the selected optimizer and store it in engine
+    OptimizerEngine* engine = InputManager::startOptimization (simCtx.opt, simCtx.sol, simCtx.veh, ui->resultsProgressBar, ui->resultsStatusLabel,
+                                                               newCheckpointFile(), simCtx.runMemory, simCtx.resultStore);
+    connectEngine(engine);
+}
+
+/**
+ * @brief Slot triggered when the "Resume" button is clicked.
+ *
+ * Asks for a checkpoint file (the newest one by default) and continues the
+ * genetic algorithm run saved in it, with the vehicle and configurations saved in the file.
+ */
+void MainWindow::on_resumeButton_clicked()
+{
+    QDir folder(checkpointFolder());
+    QFileInfoList saved = folder.entryInfoList({"*.ckpt"}, QDir::Files, QDir::Time);
+    QString newest = saved.isEmpty() ? folder.path() : saved.first().absoluteFilePath();
+    QString fileName = QFileDialog::getOpenFileName(this, tr("Resume Optimization"), newest, tr("Checkpoints (*.ckpt);;All Files (*)"));
+    if (fileName.isEmpty()) {
+        return; // user canceled
+    }
+
+    ui->resultsStatusLabel->setText("Optimization resuming...");
+    ui->resultsProgressBar->setValue(0);
+    OptimizerEngine* engine = InputManager::resumeOptimization(fileName, ui->resultsProgressBar, ui->resultsStatusLabel);
+    if (!engine) {
+        ui->resultsStatusLabel->setText("Optimization not resumed");
+    }
+    connectEngine(engine);
+}
+
+/**
+ * @brief Slot triggered when the "Cold start" check box is toggled.
+ *
+ * When checked, the next runs ignore the result of the previous one and build their initial
+ * population only from the sampling design.
+ */
+void MainWindow::on_coldStartCheckBox_toggled(bool checked)
+{
+    simCtx.opt.ColdStart = checked;
+}
+
+QString MainWindow::checkpointFolder() const
+{
+    // Application data folder like the ResultStore, so the home folder is not cluttered
+    QString data = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation);
+    if (data.isEmpty()) data = QDir(QDir::homePath()).filePath(".BicycleModel");
+    QDir().mkpath(data);
+    return data;
+}
+
+QString MainWindow::newCheckpointFile() const
+{
+    // One file per run, so a new run or a second instance never overwrites a checkpoint worth resuming
+    QDir folder(checkpointFolder());
+    QFileInfoList saved = folder.entryInfoList({"BicycleModel-*.ckpt"}, QDir::Files, QDir::Time);
+    for (int i = KeptCheckpoints - 1; i < saved.size(); i++) {
+        QFile::remove(saved[i].absoluteFilePath());
+    }
+
+    QString stamp = QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss-zzz");
+    return folder.filePath(QString("BicycleModel-%1-%2.ckpt").arg(stamp).arg(QCoreApplication::applicationPid()));
+}
+
+void MainWindow::connectEngine(OptimizerEngine* engine)
+{
+    if (engine){
+        // The token outlives the engine, so Stop is safe even while the engine thread is finishing
+        stopToken = engine->cancellationToken();
+        ui->stopButton->setEnabled(true);
+        std::shared_ptr<CancellationToken> token = stopToken;
+        QObject::connect(engine, &OptimizerEngine::finished, this, [this, token]() {
+            if (stopToken == token) {
+                stopToken.reset();
+                ui->stopButton->setEnabled(false);
+            }
+        });
+
+        // Conecting Results Text Box generated by the optimizer to the Results Tab 
+        QObject::connect(engine, &OptimizerEngine::summaryReady, this, [=](const QString& summary){ 
             simCtx.resultsText += QString("=======OPTIMIZATION RUN %1 ===========\n\n").arg(simCtx.runCount);
             simCtx.resultsText += summary + "\n";
             ui->resultsTextEdit->setPlainText(simCtx.resultsText);
             simCtx.runCount++;
         });
         
-        // Conecting Results Text Label to GA Results
+        // Conecting Results Text Label to the optimizer Results
 
-        QObject::connect(ga, &GeneticAlgorithm::optimizationFinished, this, [=](const Individual& best){ 
+        QObject::connect(engine, &OptimizerEngine::optimizationFinished, this, [=](const Individual& best){ 
 
         ui->velocityLabel->setText(QString::number(best.fitness));
         ui->accelerationLabel->setText(QString::number(best.ay));
@@ -422,6 +534,21 @@ void MainWindow::on_calculateButton_clicked()
     }
 }
 
+/**
+ * @brief Slot triggered when the "Stop" button is clicked.
+ * 
+ * Asks the running optimization to stop. The engine finishes the solves in progress
+ * and reports the best result found so far through the usual signals.
+ */
+void MainWindow::on_stopButton_clicked()
+{
+    if (stopToken) {
+        stopToken->cancel();
+        ui->resultsStatusLabel->setText("Stopping optimization...");
+        ui->stopButton->setEnabled(false);
+    }
+}
+
 //          RESULTS TAB
 
 /**
@@ -3,7 +3,11 @@
 
 #include <QMainWindow>
 #include "src/controller/simulation_inputs.h"
+#include "src/model/cancellation_token.h"
 #include <QComboBox>
+#include <memory>
+
+class OptimizerEngine;
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -68,11 +72,16 @@ private slots:
 
     void on_Eqn7TolInput_editingFinished();
 
+    void on_formulationComboBox_currentIndexChanged(int index);
+
     void on_genNumInput_editingFinished();
 
     void on_minDeltaInput_editingFinished();
 
     void on_PopSizeInput_editingFinished();
+    void on_seedInput_editingFinished();
+
+    void on_optimizerComboBox_currentIndexChanged(int index);
 
     void on_maxDeltaInput_editingFinished();
 
@@ -100,6 +109,12 @@ private slots:
 
     void on_calculateButton_clicked();
 
+    void on_stopButton_clicked();
+
+    void on_resumeButton_clicked();
+
+    void on_coldStartCheckBox_toggled(bool checked);
+
     void on_resultsSaveButton_clicked();
 
     void on_resultsCleanButton_clicked();
@@ -118,5 +133,18 @@ private:
     Ui::MainWindow *ui;
 
     SimulationContext simCtx; 
+
+    std::shared_ptr<CancellationToken> stopToken;   //!< Stop request of the running optimization, null when idle
+
+    //! Connects a started engine to the Stop button, the results text and the result labels.
+    void connectEngine(OptimizerEngine* engine);
+
+    static constexpr int KeptCheckpoints = 5;   //!< Checkpoint files kept in the checkpoint folder, the oldest ones are deleted
+
+    //! Folder of the checkpoint files, in the application data folder.
+    QString checkpointFolder() const;
+
+    //! New checkpoint file for a run, named after its start time; prunes the folder to the KeptCheckpoints newest files.
+    QString newCheckpointFile() const;
 };
 #endif // MAINWINDOW_H
@@ -0,0 +1,84 @@
+#include "src/Model/genetic_algorithm.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/*
+    Counts the heap allocations of whole generations of the GA. Every genome shares one cache
+    entry, so the solver is never called, no solve task is dispatched to the scheduler and only the
+    GA bookkeeping (ranking, selection, breeding in the second arena, batch planning, the swap) is
+    measured: after a first generation that sizes the buffers, it must not allocate at all.
+    Generations that solve rows also allocate their tasks, which this test does not cover
+*/
+
+static std::atomic<size_t> allocations{0};
+
+void* operator new(std::size_t size) {
+    allocations++;
+    if (void* p = std::malloc(size > 0 ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+class GeneticAlgorithmTest {
+public:
+    static int run() {
+        Vehicle veh(50.0, 1.2, 1.6, 1600.0, 0.0, 0.32, 1.0, 0.001);
+        setDefaultTires(veh.FrontTire, veh.RearTire);
+        SolverConfig sol;
+        OptimizationConfig opt;
+        opt.PopSize = 40;
+        opt.Seed = 1;
+        opt.Threads = 2;
+        opt.CacheQuantum = 1e9;         // Every genome rounds to the same key, so no row reaches the scheduler
+
+        Individual solved(0.085, 0.0);
+        solved.defineGuesses(0.0, 0.0, 0.0, 0.0, 10.0, 10.0, 0.0);
+        solveIndividual(solved, veh, sol, opt);
+        if (!solved.converged) {
+            std::printf("FAILED: the reference Individual did not converge\n");
+            return 1;
+        }
+
+        GeneticAlgorithm ga(veh, opt, sol);
+        ga.seed = opt.Seed;
+        ga.progress.start(1.0);
+        ga.cache.store(solved, 1, solved);                  // Mutated rows are solved from one guess
+        ga.cache.store(solved, opt.MultiStarts, solved);    // Children from MultiStarts guesses
+
+        size_t size = static_cast<size_t>(opt.PopSize);
+        ga.population.resize(size);
+        for (size_t i = 0; i < size; i++) {
+            Individual row = solved;
+            row.delta = opt.minDelta + (opt.maxDelta - opt.minDelta) * i / size;
+            ga.population.set(i, row);
+        }
+
+        // The first generation sizes the second arena and the workspace
+        if (!ga.evolveGeneration(ga.population, ga.nextPopulation, size, 0, 1, ga.workspace)) {
+            std::printf("FAILED: the first generation was stopped\n");
+            return 1;
+        }
+
+        size_t before = allocations.load();
+        for (uint32_t generation = 2; generation <= 3; generation++) {
+            ga.evolveGeneration(ga.population, ga.nextPopulation, size, 0, generation, ga.workspace);
+        }
+        size_t count = allocations.load() - before;
+
+        std::printf("%zu heap allocations in 2 generations, %zu solver calls\n", count, ga.solveCount.load());
+        if (count != 0 || ga.solveCount.load() != 0 || ga.population.size() != size) {
+            std::printf("FAILED: a generation allocated or called the solver\n");
+            return 1;
+        }
+        return 0;
+    }
+};
+
+int main() {
+    return GeneticAlgorithmTest::run();
+}
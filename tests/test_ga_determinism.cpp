@@ -0,0 +1,77 @@
+#include "src/Model/genetic_algorithm.h"
+
+#include <cstdio>
+#include <vector>
+
+/*
+    A seeded generational GA must give the same run whatever the number of threads: the same
+    best Individual, the same final population and the same solver, cache and duplicate counters
+*/
+
+struct RunResult {
+    Individual best;
+    std::vector<double> fitness;
+    std::vector<double> delta;
+    size_t solves = 0;
+    size_t cacheHits = 0;
+    size_t duplicates = 0;
+};
+
+class GeneticAlgorithmTest {
+public:
+    static RunResult run(int threads) {
+        Vehicle veh(50.0, 1.2, 1.6, 1600.0, 0.0, 0.32, 1.0, 0.001);
+        setDefaultTires(veh.FrontTire, veh.RearTire);
+        SolverConfig sol;
+        OptimizationConfig opt;
+        opt.PopSize = 24;
+        opt.GenNum = 6;
+        opt.Seed = 7;
+        opt.Threads = threads;
+        opt.MultiStarts = 2;
+        opt.RejectDuplicates = true;
+        opt.StagnationWindow = 0;
+
+        GeneticAlgorithm ga(veh, opt, sol);
+        ga.run();
+
+        RunResult result;
+        result.best = ga.bestFound;
+        result.fitness.assign(ga.population.fitness(), ga.population.fitness() + ga.population.size());
+        result.delta.assign(ga.population.gene(Gene::Delta), ga.population.gene(Gene::Delta) + ga.population.size());
+        result.solves = ga.solveCount.load();
+        result.cacheHits = ga.cache.hits();
+        result.duplicates = ga.duplicatesRejected.load();
+        return result;
+    }
+};
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+int main() {
+    RunResult serial = GeneticAlgorithmTest::run(1);
+    RunResult parallel = GeneticAlgorithmTest::run(4);
+
+    std::printf("serial: best %.12g m/s at delta %.12g, %zu solves, %zu hits, %zu duplicates\n",
+                serial.best.fitness, serial.best.delta, serial.solves, serial.cacheHits, serial.duplicates);
+    std::printf("parallel: best %.12g m/s at delta %.12g, %zu solves, %zu hits, %zu duplicates\n",
+                parallel.best.fitness, parallel.best.delta, parallel.solves, parallel.cacheHits, parallel.duplicates);
+
+    check(serial.best.fitness > 0.0, "the serial run found no solution");
+    check(serial.best.fitness == parallel.best.fitness, "best fitness differs");
+    check(serial.best.delta == parallel.best.delta, "best delta differs");
+    check(serial.best.residuals == parallel.best.residuals, "best residuals differ");
+    check(serial.fitness == parallel.fitness, "final population fitness differs");
+    check(serial.delta == parallel.delta, "final population delta differs");
+    check(serial.solves == parallel.solves, "solver calls differ");
+    check(serial.cacheHits == parallel.cacheHits, "cache hits differ");
+    check(serial.duplicates == parallel.duplicates, "rejected duplicates differ");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include "src/Model/eqn_solver.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+/*
+    Adaptive against legacy residual scaling on a light and a heavy car. The same grid of
+    deltas and initial guesses is solved with both: the adaptive scaling must not fail more
+    often, must not need more iterations and must give a better conditioned Jacobian. Where
+    both reach the same solution, the tolerance check must accept it under both
+*/
+
+struct GridResult {
+    int failed = 0;
+    long long iterations = 0;
+    std::vector<Individual> solutions;     // One per grid point, in grid order
+    std::vector<bool> accepted;
+};
+
+static int failures = 0;
+
+static void check(bool condition, const char* what, double mass) {
+    if (!condition) {
+        std::printf("FAILED: %s (m = %g kg)\n", what, mass);
+        failures++;
+    }
+}
+
+static GridResult solveGrid(Vehicle& veh, const SolverConfig& sol) {
+    const double guesses[][7] = {
+        {0.0, 0.0, 0.0, 0.0, 10.0, 10.0, 0.0},
+        {0.01, 0.01, 0.005, 0.005, 10.0, 10.0, 0.2},
+        {0.05, 0.05, 0.02, 0.02, 20.0, 20.0, 1.0},
+    };
+    GridResult result;
+    for (double delta = 0.02; delta <= 0.1001; delta += 0.02) {
+        for (const double* g : guesses) {
+            Individual ind(delta, g[0]);
+            ind.defineGuesses(g[0], g[1], g[2], g[3], g[4], g[5], g[6]);
+            solveIndividual(ind, veh, sol, OptimizationConfig());
+
+            // The verdict is the tolerance check of the residuals, whatever Ceres reported as termination
+            bool accepted = checkResiduals(ind, sol);
+            result.failed += accepted ? 0 : 1;
+            result.iterations += ind.stats.iterations;
+            result.solutions.push_back(ind);
+            result.accepted.push_back(accepted);
+        }
+    }
+    return result;
+}
+
+static void compareScalings(double mass) {
+    Vehicle veh(50.0, 1.2, 1.6, mass, 0.0, 0.32, 1.0, 0.001);
+    setDefaultTires(veh.FrontTire, veh.RearTire);
+
+    SolverConfig legacy;
+    legacy.adaptiveScaling = false;
+    SolverConfig adaptive = legacy;
+    adaptive.adaptiveScaling = true;
+
+    GridResult withLegacy = solveGrid(veh, legacy);
+    GridResult withAdaptive = solveGrid(veh, adaptive);
+
+    // Conditioning of both scalings at the same solutions, the ones the adaptive solve accepted
+    double logLegacy = 0.0, logAdaptive = 0.0;
+    int conditioned = 0;
+    int sameSolution = 0;
+    for (size_t i = 0; i < withAdaptive.solutions.size(); i++) {
+        const Individual& a = withAdaptive.solutions[i];
+        const Individual& l = withLegacy.solutions[i];
+        if (withAdaptive.accepted[i]) {
+            logLegacy += std::log10(jacobianConditionNumber(a, veh, legacy));
+            logAdaptive += std::log10(jacobianConditionNumber(a, veh, adaptive));
+            conditioned++;
+        }
+        // Same physical solution from both solves: the acceptance can not depend on the scaling
+        if (std::abs(a.V_guess - l.V_guess) < 1e-6 * std::abs(l.V_guess) && std::abs(a.delta - l.delta) < 1e-12) {
+            sameSolution++;
+            check(withAdaptive.accepted[i] == withLegacy.accepted[i], "the same solution gets different verdicts", mass);
+        }
+    }
+
+    std::printf("m = %g kg: failed %d legacy / %d adaptive, iterations %lld legacy / %lld adaptive, "
+                "mean log10 condition %.2f legacy / %.2f adaptive, %d common solutions\n",
+                mass, withLegacy.failed, withAdaptive.failed, withLegacy.iterations, withAdaptive.iterations,
+                conditioned > 0 ? logLegacy / conditioned : 0.0, conditioned > 0 ? logAdaptive / conditioned : 0.0, sameSolution);
+
+    check(conditioned > 0, "no adaptive solve was accepted, the comparison is empty", mass);
+    check(withAdaptive.failed <= withLegacy.failed, "adaptive scaling fails more solves", mass);
+    check(withAdaptive.iterations <= withLegacy.iterations, "adaptive scaling needs more iterations", mass);
+    check(logAdaptive < logLegacy, "adaptive scaling does not lower the Jacobian condition number", mass);
+}
+
+int main() {
+    compareScalings(800.0);
+    compareScalings(3000.0);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+#include "src/Model/task_scheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <thread>
+
+/*
+    Load accounting and helping rules of the TaskScheduler with nested TaskGroups:
+    a worker waiting on nested tasks is not counted busy twice, and it never runs
+    unrelated top-level work on top of the task that is waiting
+*/
+
+using namespace std::chrono;
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+// One worker runs an outer task that waits on two nested 100 ms tasks
+static void nestedBusyTime() {
+    TaskScheduler pool(1);
+    pool.resetStats();
+    auto start = steady_clock::now();
+    std::promise<void> done;
+    TaskGroup outer(pool);
+    outer.run([&done]() {
+        TaskGroup inner;
+        for (int i = 0; i < 2; i++) {
+            inner.run([]() { std::this_thread::sleep_for(milliseconds(100)); });
+        }
+        inner.wait();
+        done.set_value();
+    });
+    done.get_future().wait();
+    double wall = duration<double>(steady_clock::now() - start).count();
+    outer.wait();
+
+    double busy = pool.stats()[0].busySeconds;
+    std::printf("nested: wall %.3f s, busy %.3f s\n", wall, busy);
+    check(busy <= 1.05 * wall, "nested task time counted twice");
+}
+
+// Worker A waits while its nested task runs on worker B, a top-level task queued meanwhile must not run inside A
+static void waitingTaskDoesNotRunTopLevelWork() {
+    TaskScheduler pool(2);
+    std::atomic<bool> aWaiting{false};
+    std::atomic<bool> ranInside{false};
+    std::atomic<std::thread::id> aThread{};
+    std::promise<void> stolen;
+    std::shared_future<void> nestedStarted = stolen.get_future().share();
+
+    TaskGroup top(pool);
+    top.run([&]() {
+        aThread = std::this_thread::get_id();
+        TaskGroup inner;
+        inner.run([&]() {
+            stolen.set_value();
+            std::this_thread::sleep_for(milliseconds(200));
+        });
+        // Leave the nested task to the other worker before waiting
+        if (nestedStarted.wait_for(seconds(2)) != std::future_status::ready) return;
+        aWaiting = true;
+        inner.wait();
+        aWaiting = false;
+    });
+
+    if (nestedStarted.wait_for(seconds(2)) == std::future_status::ready) {
+        std::this_thread::sleep_for(milliseconds(50));
+        // The main thread does not help, so only the workers can take the task
+        std::promise<void> otherDone;
+        TaskGroup other(pool);
+        other.run([&]() {
+            ranInside = aWaiting.load() && std::this_thread::get_id() == aThread.load();
+            otherDone.set_value();
+        });
+        otherDone.get_future().wait();
+        other.wait();
+    }
+    top.wait();
+    std::printf("top-level task inside the waiting one: %s\n", ranInside.load() ? "yes" : "no");
+    check(!ranInside.load(), "a waiting worker ran a top-level task on its stack");
+}
+
+int main() {
+    nestedBusyTime();
+    waitingTaskDoesNotRunTopLevelWork();
+    return failures == 0 ? 0 : 1;
+}